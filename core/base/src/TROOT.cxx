@@ -533,6 +533,8 @@ namespace Internal {
    /// variable `ROOT_MAX_THREADS`: `export ROOT_MAX_THREADS=2` will try to set
    /// the maximum number of active threads to 2, if the scheduling library
    /// (such as tbb) "permits".
+   /// On Linux, `export ROOT_NUMA_BINDING=1` binds each worker thread to the CPUs
+   /// of one NUMA node, spreading the workers evenly over the nodes.
    ///
    /// \note Use `DisableImplicitMT()` to disable multi-threading (some locks will remain in place as
    /// described in EnableThreadSafety()). `EnableImplicitMT(1)` creates a thread-pool of size 1.
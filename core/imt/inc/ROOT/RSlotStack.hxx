@@ -13,7 +13,7 @@
 
 #include <ROOT/TSpinMutex.hxx>
 
-#include <stack>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -27,10 +27,13 @@ namespace Internal {
 /// An important design assumption is that a slot will almost always be available
 /// when a thread asks for it, and if it is not available it will be very soon,
 /// therefore a spinlock is used for synchronization.
+/// Slots are thread-affine: GetSlot hands a thread back the slot it returned last, if
+/// that slot is still free, so that per-slot state tends to stay in the caches (and
+/// on the NUMA node) of the core that last touched it.
 class RSlotStack {
 private:
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
+   std::vector<unsigned int> fStack;
    ROOT::TSpinMutex fMutex;
 
 public:
@@ -1,5 +1,13 @@
 #include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+
+#include <memory>
 
 namespace ROOT {
-class ROpaqueTaskArena: public tbb::task_arena {};
+class ROpaqueTaskArena: public tbb::task_arena {
+public:
+   /// Optional observer binding the arena's worker threads to NUMA nodes, see RTaskArenaWrapper.
+   /// Declared after the arena base, hence destroyed (and detached) before it.
+   std::unique_ptr<tbb::task_scheduler_observer> fNUMABinding;
+};
 }
@@ -11,13 +11,24 @@
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RSlotStack.hxx>
 
+#include <algorithm>
 #include <cassert>
 #include <mutex> // std::lock_guard
 
+namespace {
+/// The slot the current thread last returned, and the stack it was returned to.
+struct RLastSlot {
+   const ROOT::Internal::RSlotStack *fStack = nullptr;
+   unsigned int fSlot = 0u;
+};
+thread_local RLastSlot gLastSlot;
+} // anonymous namespace
+
 ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
 {
+   fStack.reserve(size);
    for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
+      fStack.push_back(i);
 }
 
 void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
@@ -25,14 +36,23 @@ void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
    std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
    assert(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
    (void)fSize;
-   fStack.push(slot);
+   fStack.push_back(slot);
+   gLastSlot = {this, slot};
 }
 
 unsigned int ROOT::Internal::RSlotStack::GetSlot()
 {
    std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
    assert(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
+   auto it = fStack.end() - 1;
+   if (gLastSlot.fStack == this) {
+      // prefer the slot this thread used last, so its per-slot data is likely still in a nearby cache
+      auto lastIt = std::find(fStack.begin(), fStack.end(), gLastSlot.fSlot);
+      if (lastIt != fStack.end())
+         it = lastIt;
+   }
+   const auto slot = *it;
+   *it = fStack.back();
+   fStack.pop_back();
    return slot;
 }
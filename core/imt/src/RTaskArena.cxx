@@ -7,11 +7,15 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TThread.h"
+#include <atomic>
 #include <fstream>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 #include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
 
@@ -40,8 +44,89 @@
 /// root[] gTA->Access().max_concurrency() // call to tbb::task_arena::max_concurrency()
 /// ~~~
 ///
+/// On Linux, if the environment variable `ROOT_NUMA_BINDING` is set to `1`,
+/// the worker threads joining the arena are bound to the CPUs of one NUMA node
+/// each, distributing them round-robin over the nodes of the machine. Together
+/// with the thread affinity of ROOT::Internal::RSlotStack this keeps per-slot
+/// data on the memory node of the thread that uses it.
+///
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef R__LINUX
+#include <sched.h>
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Parse a sysfs cpu list such as "0-3,8-11" into the list of cpu ids.
+std::vector<int> ParseCPUList(const std::string &cpuList)
+{
+   std::vector<int> cpus;
+   std::stringstream ss(cpuList);
+   std::string range;
+   while (std::getline(ss, range, ',')) {
+      if (range.empty())
+         continue;
+      const auto dash = range.find('-');
+      const int first = std::stoi(range.substr(0, dash));
+      const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu)
+         cpus.push_back(cpu);
+   }
+   return cpus;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the cpus of each NUMA node that has any, as listed in sysfs.
+std::vector<std::vector<int>> GetNUMANodeCPUs()
+{
+   std::vector<std::vector<int>> nodes;
+   for (int node = 0;; ++node) {
+      std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      if (!f)
+         break;
+      std::string cpuList;
+      std::getline(f, cpuList);
+      auto cpus = ParseCPUList(cpuList);
+      if (!cpus.empty())
+         nodes.emplace_back(std::move(cpus));
+   }
+   return nodes;
+}
+
+/// Binds every worker thread entering the observed arena to the cpus of one NUMA node.
+class RNUMABindingObserver final : public tbb::task_scheduler_observer {
+   const std::vector<std::vector<int>> fNodeCPUs;
+   std::atomic<unsigned> fNextNode{0u};
+
+public:
+   RNUMABindingObserver(tbb::task_arena &arena, std::vector<std::vector<int>> &&nodeCPUs)
+      : tbb::task_scheduler_observer(arena), fNodeCPUs(std::move(nodeCPUs))
+   {
+      observe(true);
+   }
+   ~RNUMABindingObserver() { observe(false); }
+
+   void on_scheduler_entry(bool isWorker) final
+   {
+      // Threads can enter the arena many times: keep the node they were assigned first.
+      // The main thread is left alone, its affinity is the user's business.
+      thread_local bool isBound = false;
+      if (!isWorker || isBound)
+         return;
+      isBound = true;
+      const auto &cpus = fNodeCPUs[fNextNode++ % fNodeCPUs.size()];
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      for (int cpu : cpus)
+         CPU_SET(cpu, &cpuSet);
+      sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+   }
+};
+
+} // anonymous namespace
+#endif // R__LINUX
+
 namespace ROOT {
 namespace Internal {
 
@@ -105,6 +190,15 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
    }
    fTBBArena->initialize(maxConcurrency);
    fNWorkers = maxConcurrency;
+#ifdef R__LINUX
+   const char *envNUMABinding = gSystem->Getenv("ROOT_NUMA_BINDING");
+   if (envNUMABinding && std::string(envNUMABinding) == "1") {
+      auto nodeCPUs = GetNUMANodeCPUs();
+      // nothing to gain on single-node machines
+      if (nodeCPUs.size() > 1)
+         fTBBArena->fNUMABinding.reset(new RNUMABindingObserver(*fTBBArena, std::move(nodeCPUs)));
+   }
+#endif
    ROOT::EnableThreadSafety();
 }
 
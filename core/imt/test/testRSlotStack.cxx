@@ -0,0 +1,35 @@
+#include "ROOT/RSlotStack.hxx"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <thread>
+
+TEST(RSlotStack, AllSlotsAreHandedOut)
+{
+   ROOT::Internal::RSlotStack stack(4);
+   std::set<unsigned int> slots;
+   for (int i = 0; i < 4; ++i)
+      slots.insert(stack.GetSlot());
+   EXPECT_EQ(slots, (std::set<unsigned int>{0u, 1u, 2u, 3u}));
+   for (auto s : slots)
+      stack.ReturnSlot(s);
+}
+
+TEST(RSlotStack, ThreadGetsBackItsLastSlot)
+{
+   ROOT::Internal::RSlotStack stack(4);
+   const auto mySlot = stack.GetSlot();
+   stack.ReturnSlot(mySlot);
+
+   // another thread takes and returns a different slot in the meantime
+   std::thread t([&stack, mySlot] {
+      auto s1 = stack.GetSlot();
+      auto s2 = stack.GetSlot();
+      stack.ReturnSlot(s1 == mySlot ? s1 : s2);
+      stack.ReturnSlot(s1 == mySlot ? s2 : s1);
+   });
+   t.join();
+
+   EXPECT_EQ(stack.GetSlot(), mySlot);
+}
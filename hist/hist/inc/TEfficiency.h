@@ -18,6 +18,7 @@
 
 
 class TCollection;
+class TEfficiencyIntervalCache;
 class TF1;
 class TGraphAsymmErrors;
 class TGraph2DAsymmErrors;
@@ -27,6 +28,8 @@ class TList;
 
 class TEfficiency: public TNamed, public TAttLine, public TAttFill, public TAttMarker
 {
+   friend class TEfficiencyIntervalCache;
+
 public:
    /// Enumeration type for different statistic options for calculating confidence intervals
    /// kF* ... frequentist methods; kB* ... bayesian methods
@@ -59,6 +62,7 @@ protected:
       EStatOption   fStatisticOption;        ///<  Defines how the confidence intervals are determined
       TH1*          fTotalHistogram;         ///<  Histogram for total number of events
       Double_t      fWeight;                 ///<  Weight for all events (default = 1)
+      mutable TEfficiencyIntervalCache* fIntervalCache=nullptr; ///<! Confidence intervals computed by ComputeIntervals
 
       enum EStatusBits {
          kIsBayesian       = BIT(14),  ///< Bayesian statistics are used
@@ -72,6 +76,7 @@ protected:
       void          FillGraph(TGraphAsymmErrors * graph, Option_t * opt) const;
       void          FillGraph2D(TGraph2DAsymmErrors * graph, Option_t * opt) const;
       void          FillHistogram(TH2 * h2) const;
+      Bool_t        GetCachedInterval(Int_t bin, Double_t &errLow, Double_t &errUp) const;
 
 public:
       TEfficiency();
@@ -96,6 +101,7 @@ public:
 
       void          Add(const TEfficiency& rEff) {*this += rEff;}
       void          Browse(TBrowser*) override{Draw();}
+      void          ComputeIntervals() const;
       TGraphAsymmErrors*   CreateGraph(Option_t * opt = "") const;
       TGraph2DAsymmErrors*   CreateGraph2D(Option_t * opt = "") const;
       TH2*          CreateHistogram(Option_t * opt = "") const;
@@ -104,6 +110,8 @@ public:
       void  ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
       void          Fill(Bool_t bPassed,Double_t x,Double_t y=0,Double_t z=0);
       void          FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_t y=0,Double_t z=0);
+      void          FillN(Int_t n,const Bool_t* bPassed,const Double_t* x,const Double_t* y=nullptr,
+                          const Double_t* z=nullptr,const Double_t* weight=nullptr);
       Int_t         FindFixBin(Double_t x,Double_t y=0,Double_t z=0) const;
       TFitResultPtr Fit(TF1* f1,Option_t* opt="");
       // use trick of -1 to return global parameters
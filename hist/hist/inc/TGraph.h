@@ -29,6 +29,8 @@
 #include "TVectorDfwd.h"
 #include "TFitResultPtr.h"
 
+#include <atomic>
+
 class TBrowser;
 class TAxis;
 class TH1;
@@ -36,6 +38,7 @@ class TH1F;
 class TCollection;
 class TF1;
 class TSpline;
+class TSpline3;
 class TList;
 
 class TGraph : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
@@ -51,6 +54,8 @@ protected:
    Double_t           fMinimum;   ///< Minimum value for plotting along y
    Double_t           fMaximum;   ///< Maximum value for plotting along y
    TString fOption;               ///< Options used for drawing the graph
+   struct TEvalSplineCache;
+   mutable std::atomic<TEvalSplineCache *> fEvalSpline{nullptr}; ///<! Spline through the points used by Eval with option "S"
 
    static void        SwapValues(Double_t* arr, Int_t pos1, Int_t pos2);
    virtual void       SwapPoints(Int_t pos1, Int_t pos2);
@@ -65,6 +70,8 @@ protected:
    virtual void       FillZero(Int_t begin, Int_t end, Bool_t from_ctor = kTRUE);
    Double_t         **ShrinkAndCopy(Int_t size, Int_t iend);
    virtual Bool_t     DoMerge(const TGraph * g);
+   const TSpline3    &GetEvalSpline() const;
+   void               ResetEvalSpline();
 
    TString            SaveArray(std::ostream &out, const char *suffix, Int_t frameNumber, Double_t *arr);
    void               SaveHistogramAndFunctions(std::ostream &out, const char *varname, Int_t &frameNumber, Option_t *option);
@@ -112,6 +119,7 @@ public:
    virtual void          DrawGraph(Int_t n, const Double_t *x=nullptr, const Double_t *y=nullptr, Option_t *option="");
    virtual void          DrawPanel(); // *MENU*
    virtual Double_t      Eval(Double_t x, TSpline *spline=nullptr, Option_t *option="") const;
+   virtual void          EvalN(Int_t n, const Double_t *x, Double_t *y, TSpline *spline=nullptr, Option_t *option="") const;
    void                  ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
    virtual void          Expand(Int_t newsize);
    virtual void          Expand(Int_t newsize, Int_t step);
@@ -54,6 +54,7 @@ class TCollection;
 class TVirtualFFT;
 class TVirtualHistPainter;
 class TRandom;
+class TH1ConcurrentFill;
 
 
 class TH1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
@@ -84,6 +85,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class TH1ConcurrentFill;
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
@@ -110,6 +112,7 @@ protected:
     Int_t         fDimension;       ///<! Histogram dimension (1, 2 or 3 dim)
     Double_t     *fIntegral;        ///<! Integral of bins used by GetRandom
     TVirtualHistPainter *fPainter;  ///<! Pointer to histogram painter
+    TH1ConcurrentFill *fConcurrentFill; ///<! State of the concurrent fill mode, see SetConcurrentFill
     EBinErrorOpt  fBinStatErrOpt;   ///<  Option for bin statistical errors
     EStatOverflows fStatOverflows;  ///<  Per object flag to use under/overflows in statistics
     static Int_t  fgBufferSize;     ///<! Default buffer size for automatic histograms
@@ -149,6 +152,7 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+           void     DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -335,6 +339,7 @@ public:
    virtual Double_t Interpolate(Double_t x, Double_t y, Double_t z) const;
            Bool_t   IsBinOverflow(Int_t bin, Int_t axis = 0) const;
            Bool_t   IsBinUnderflow(Int_t bin, Int_t axis = 0) const;
+           Bool_t   IsConcurrentFill() const { return fConcurrentFill != nullptr; }
    virtual Bool_t   IsHighlight() const { return TestBit(kIsHighlight); }
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Option_t *option="") const;
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Double_t &advalue) const;
@@ -382,6 +387,7 @@ public:
    virtual void     SetBuffer(Int_t buffersize, Option_t *option="");
    virtual UInt_t   SetCanExtend(UInt_t extendBitMask);
    virtual void     SetContent(const Double_t *content);
+           void     SetConcurrentFill(Bool_t on = kTRUE);
    virtual void     SetContour(Int_t nlevels, const Double_t *levels = nullptr);
    virtual void     SetContourLevel(Int_t level, Double_t value);
    virtual void     SetColors(Color_t linecolor = -1, Color_t markercolor = -1, Color_t fillcolor = -1);
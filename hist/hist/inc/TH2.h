@@ -29,6 +29,8 @@ class TProfile;
 
 class TH2 : public TH1 {
 
+   friend class TH1ConcurrentFill;
+
 protected:
    Double_t     fScalefactor;     ///< Scale factor
    Double_t     fTsumwy;          ///< Total Sum of weight*Y
@@ -48,6 +50,7 @@ protected:
                                          ,Int_t nbinsy,const Float_t  *ybins);
 
    virtual Int_t     BufferFill(Double_t x, Double_t y, Double_t w);
+           void      DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride);
    virtual TH1D     *DoProjection(bool onX, const char *name, Int_t firstbin, Int_t lastbin, Option_t *option) const;
    virtual TProfile *DoProfile(bool onX, const char *name, Int_t firstbin, Int_t lastbin, Option_t *option) const;
    virtual TH1D     *DoQuantiles(bool onX, const char *name, Double_t prob) const;
@@ -30,6 +30,8 @@ class TProfile2D;
 
 class TH3 : public TH1, public TAtt3D {
 
+   friend class TH1ConcurrentFill;
+
 protected:
    Double_t     fTsumwy;          ///< Total Sum of weight*Y
    Double_t     fTsumwy2;         ///< Total Sum of weight*Y*Y
@@ -50,6 +52,8 @@ protected:
                                          ,Int_t nbinsy,const Double_t *ybins
                                          ,Int_t nbinsz,const Double_t *zbins);
    virtual Int_t    BufferFill(Double_t x, Double_t y, Double_t z, Double_t w);
+           void     DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z,
+                                     const Double_t *w, Int_t stride);
 
    void DoFillProfileProjection(TProfile2D * p2, const TAxis & a1, const TAxis & a2, const TAxis & a3, Int_t bin1, Int_t bin2, Int_t bin3, Int_t inBin, Bool_t useWeights) const;
 
@@ -91,6 +95,9 @@ public:
    virtual Int_t    Fill(const char *namex, Double_t y, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, const char *namey, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, Double_t y, const char *namez, Double_t w);
+   using TH1::FillN;
+   virtual void     FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                          Int_t stride = 1);
 
            void     FillRandom(const char *fname, Int_t ntimes=5000, TRandom *rng = nullptr) override;
            void     FillRandom(TH1 *h, Int_t ntimes=5000, TRandom *rng = nullptr) override;
@@ -157,6 +157,7 @@ protected:
       FillBin(bin, w);
       return bin;
    }
+   void FillN(Int_t nentries, const Double_t *x, const Double_t *w = nullptr);
 
    /// Fill with the provided variadic arguments.
    /// The number of arguments must be equal to the number of histogram dimensions or, for weighted fills, to the
@@ -23,6 +23,9 @@
 
 class TGraphErrors;
 class TF1;
+namespace ROOT {
+class TThreadExecutor;
+}
 
 /*
    Kernel Density Estimation class.
@@ -76,6 +79,13 @@ public:
       kForcedBinning
    };
 
+   /// Evaluation of the density.
+   /// It can be set using SetEvaluation() or as a string in the constructor
+   enum EEvaluation {
+      kExactEvaluation, ///< Sum the kernels of all data points (or bins) at each evaluation point
+      kGridEvaluation   ///< Interpolate the density computed on a fine grid by FFT convolution, see SetGridTolerance()
+   };
+
    ///  default constructor used only by I/O
    TKDE();
 
@@ -88,6 +98,7 @@ public:
    /// For this reason, by default for Nevents >=10000, the data are automatically binned  in
    /// nbins=Min(10000,Nevents/10)
    /// In case of ForceBinning option the default number of bins is 1000
+   /// For large samples, the option Evaluation:Grid computes the density once on a fine grid (see SetEvaluation())
    TKDE(UInt_t events, const Double_t* data, Double_t xMin = 0.0, Double_t xMax = 0.0, const Option_t* option =
                  "KernelType:Gaussian;Iteration:Adaptive;Mirror:noMirror;Binning:RelaxedBinning", Double_t rho = 1.0) {
       Instantiate( nullptr,  events, data, nullptr, xMin, xMax, option, rho);
@@ -123,6 +134,8 @@ public:
    void SetUseBinsNEvents(UInt_t nEvents);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
+   void SetEvaluation(EEvaluation eval);
+   void SetGridTolerance(Double_t tolerance);
 
    void Draw(const Option_t* option = "") override;
 
@@ -130,6 +143,7 @@ public:
    Double_t operator()(const Double_t* x, const Double_t* p = nullptr) const;  // Needed for creating TF1
 
    Double_t GetValue(Double_t x) const { return (*this)(x); }
+   void GetValues(UInt_t n, const Double_t *x, Double_t *values) const;
    Double_t GetError(Double_t x) const;
 
    Double_t GetBias(Double_t x) const;
@@ -166,7 +180,7 @@ public:
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
    public:
       TKernel(Double_t weight, TKDE *kde);
-      void ComputeAdaptiveWeights();
+      void ComputeAdaptiveWeights(const std::vector<Double_t> &pilotGrid = {}, Double_t pilotStep = 0.);
       Double_t operator()(Double_t x) const;
       Double_t GetWeight(Double_t x) const;
       Double_t GetFixedWeight() const;
@@ -200,6 +214,7 @@ private:
    EIteration fIteration;
    EMirror fMirror;
    EBinning fBinning;
+   EEvaluation fEvaluation;
 
 
    Bool_t fUseMirroring, fMirrorLeft, fMirrorRight, fAsymLeft, fAsymRight;
@@ -227,6 +242,12 @@ private:
 
    std::vector<Double_t> fBinCount;    ///< Number of events per bin for binned data option
 
+   Double_t fGridTolerance;            ///< Target accuracy of the grid evaluation, relative to the density maximum
+   std::vector<Double_t> fGrid;        ///<! Density on the evaluation grid, from fXMin to fXMax
+   Double_t fGridStep;                 ///<! Distance between the points of fGrid
+
+   std::shared_ptr<ROOT::TThreadExecutor> fExecutor; ///<! Thread pool of GetValues() and ComputeGrid(), created on first use
+
    std::vector<Bool_t> fSettedOptions; ///< User input options flag
 
    struct KernelIntegrand;
@@ -266,6 +287,12 @@ private:
 
    UInt_t Index(Double_t x) const;
 
+   void ComputeGrid(std::vector<Double_t> &grid, Double_t &step);
+   Double_t InterpolateGrid(const std::vector<Double_t> &grid, Double_t step, Double_t x) const;
+#ifdef R__USE_IMT
+   ROOT::TThreadExecutor &GetExecutor();
+#endif
+
    void SetBinCentreData(Double_t xmin, Double_t xmax);
    void SetBinCountData();
    void CheckKernelValidity();
@@ -298,7 +325,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDefOverride(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDefOverride(TKDE, 4) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
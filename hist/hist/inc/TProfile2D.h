@@ -44,6 +44,8 @@ protected:
    Int_t    BufferFill(Double_t, Double_t) override {return -2;} //may not use
    Int_t    BufferFill(Double_t, Double_t, Double_t) override {return -2;} //may not use
    virtual Int_t    BufferFill(Double_t x, Double_t y, Double_t z, Double_t w);
+           void     DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z,
+                                     const Double_t *w, Int_t stride);
 
    // helper methods for the Merge unification in TProfileHelper
    void SetBins(const Int_t* nbins, const Double_t* range) { SetBins(nbins[0], range[0], range[1],
@@ -60,6 +62,8 @@ protected:
    Double_t GetBinErrorSqUnchecked(Int_t bin) const override { Double_t err = GetBinError(bin); return err*err; }
 
 private:
+   void FillN(Int_t, const Double_t *, const Double_t *, const Double_t *, Int_t) override
+      { MayNotUse("FillN(Int_t, Double_t*, Double_t*, Double_t*, Int_t)"); }
    Double_t *GetB()  {return &fBinEntries.fArray[0];}
    Double_t *GetB2() {return fBinSumw2.fN ? &fBinSumw2.fArray[0] : nullptr; }
    Double_t *GetW()  {return &fArray[0];}
@@ -107,6 +111,8 @@ public:
    virtual Int_t     Fill(const char *namex, Double_t y, Double_t z, Double_t w);
    virtual Int_t     Fill(const char *namex, const char *namey, Double_t z, Double_t w);
    virtual Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+   virtual void      FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                           Int_t stride=1);
    inline  Int_t     Fill(Double_t x, const char *namey, Double_t z) override { return Fill(x, namey, z, 1.0); }
    inline  Int_t     Fill(const char *namex, Double_t y, Double_t z) override { return Fill(namex, y, z, 1.0); }
    inline  Int_t     Fill(const char *namex, const char *namey, Double_t z) override { return Fill(namex, namey, z, 1.0); }
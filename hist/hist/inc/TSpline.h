@@ -63,6 +63,7 @@ public:
    virtual Double_t GetXmax()  const {return fXmax;}
    void     Paint(Option_t *option="") override;
    virtual Double_t Eval(Double_t x) const=0;
+   virtual void     EvalN(Int_t n, const Double_t *x, Double_t *y) const;
    void     SaveAs(const char * /*filename*/ = "",Option_t * /*option*/ = "") const override {}
    void             SetNpx(Int_t n) {fNpx=n;}
 
@@ -214,7 +215,9 @@ public:
    TSpline3(const TSpline3&);
    TSpline3& operator=(const TSpline3&);
    Int_t    FindX(Double_t x) const;
+   Int_t    FindX(Double_t x, Int_t hint) const;
    Double_t Eval(Double_t x) const override;
+   void     EvalN(Int_t n, const Double_t *x, Double_t *y) const override;
    Double_t Derivative(Double_t x) const;
    ~TSpline3() override {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
@@ -276,7 +279,9 @@ public:
    TSpline5(const TSpline5&);
    TSpline5& operator=(const TSpline5&);
    Int_t    FindX(Double_t x) const;
+   Int_t    FindX(Double_t x, Int_t hint) const;
    Double_t Eval(Double_t x) const override;
+   void     EvalN(Int_t n, const Double_t *x, Double_t *y) const override;
    Double_t Derivative(Double_t x) const;
    ~TSpline5() override {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
@@ -29,6 +29,8 @@
 #include <iostream>
 #include <ctime>
 #include <cassert>
+#include <algorithm>
+#include <vector>
 
 ClassImp(TAxis);
 
@@ -434,6 +436,72 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers corresponding to an array of abscissas.
+///
+/// \param[in] n number of values in x (array size must be n*stride)
+/// \param[in] x array of abscissas
+/// \param[out] bins array of at least n elements, bins[i] is set to FindFixBin(x[i*stride])
+/// \param[in] stride step size through array x
+///
+/// This is the batch version of TAxis::FindFixBin, used by TH1::FillN and friends:
+/// the loop over fixed-size bins has no branches and can be vectorised by the compiler.
+/// For variable-size bins and enough values, the bins are looked up with a uniform grid
+/// over the axis range that gives, for each value, the bin where a short linear search
+/// starts, instead of a binary search over all bin edges.
+/// The result is always identical to calling TAxis::FindFixBin on each value.
+
+void TAxis::FindFixBinN(Int_t n, const Double_t *x, Int_t *bins, Int_t stride) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t nbins = fNbins;
+   if (!fXbins.fN) {
+      const Double_t width = xmax - xmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i*stride];
+         const Bool_t inRange = xi >= xmin && xi < xmax; // false for NaN, like in FindFixBin
+         // same expression as in FindFixBin, so that values close to a bin edge end up in the same bin
+         const Int_t bin = 1 + int(nbins*((inRange ? xi : xmin) - xmin)/width);
+         bins[i] = inRange ? bin : (xi < xmin ? 0 : nbins+1);
+      }
+      return;
+   }
+
+   if (n < 4*nbins) {
+      // not enough values to amortise the construction of the lookup grid
+      for (Int_t i = 0; i < n; ++i)
+         bins[i] = TAxis::FindFixBin(x[i*stride]);
+      return;
+   }
+
+   const Double_t *edges = fXbins.fArray;
+   const Int_t ncells = 2*nbins;
+   const Double_t cellsPerUnit = ncells/(xmax - xmin);
+   // grid[c] is the bin containing the lower edge of cell c
+   std::vector<Int_t> grid(ncells+1);
+   Int_t bin = 1;
+   for (Int_t c = 0; c <= ncells; ++c) {
+      const Double_t low = xmin + c/cellsPerUnit;
+      while (bin < nbins && edges[bin] <= low) ++bin;
+      grid[c] = bin;
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i*stride];
+      if (xi < xmin) {
+         bins[i] = 0;
+      } else if (!(xi < xmax)) {
+         bins[i] = nbins+1;
+      } else {
+         // the grid only provides a starting point, the searches below make the result exact
+         Int_t b = grid[std::min(Int_t((xi - xmin)*cellsPerUnit), ncells)];
+         while (b > 1 && xi < edges[b-1]) --b;
+         while (b < nbins && xi >= edges[b]) ++b;
+         bins[i] = b;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
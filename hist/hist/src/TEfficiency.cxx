@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <cassert>
+#include <limits>
 
 //ROOT headers
 #include "Math/DistFuncMathCore.h"
@@ -33,6 +34,11 @@
 // file with extra class for FC method
 #include "TEfficiencyHelper.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 //default values
 const Double_t kDefBetaAlpha = 1;
 const Double_t kDefBetaBeta = 1;
@@ -40,6 +46,69 @@ const Double_t kDefConfLevel = 0.682689492137; // 1 sigma
 const TEfficiency::EStatOption kDefStatOpt = TEfficiency::kFCP;
 const Double_t kDefWeight = 1;
 
+////////////////////////////////////////////////////////////////////////////////
+/// Confidence intervals of all bins computed by TEfficiency::ComputeIntervals.
+///
+/// Each bin keeps the inputs its interval was computed from. An interval is only
+/// used while they are unchanged, so that filling or changing the options of the
+/// TEfficiency never gives outdated intervals.
+
+class TEfficiencyIntervalCache {
+public:
+   /// Settings the intervals of all bins depend on
+   struct TSettings {
+      Double_t fConfLevel;
+      Int_t fStatisticOption;
+      UInt_t fBits;
+      bool operator==(const TSettings &other) const
+      {
+         return fConfLevel == other.fConfLevel && fStatisticOption == other.fStatisticOption && fBits == other.fBits;
+      }
+   };
+   /// Inputs of the interval of one bin
+   struct TBinInputs {
+      Double_t fTotal;
+      Double_t fPassed;
+      Double_t fTotalW2;
+      Double_t fPassedW2;
+      Double_t fAlpha;
+      Double_t fBeta;
+      bool operator==(const TBinInputs &other) const
+      {
+         return fTotal == other.fTotal && fPassed == other.fPassed && fTotalW2 == other.fTotalW2 &&
+                fPassedW2 == other.fPassedW2 && fAlpha == other.fAlpha && fBeta == other.fBeta;
+      }
+   };
+   struct TBin {
+      TBinInputs fInputs;
+      Double_t fErrLow;
+      Double_t fErrUp;
+   };
+
+   TSettings fSettings;
+   std::vector<TBin> fBins;
+
+   static TSettings GetSettings(const TEfficiency &eff)
+   {
+      return {eff.fConfLevel, eff.fStatisticOption,
+              (UInt_t)eff.TestBits(TEfficiency::kIsBayesian | TEfficiency::kPosteriorMode |
+                                   TEfficiency::kShortestInterval | TEfficiency::kUseBinPrior |
+                                   TEfficiency::kUseWeights)};
+   }
+
+   static TBinInputs GetInputs(const TEfficiency &eff, Int_t bin)
+   {
+      const Bool_t useWeights = eff.TestBit(TEfficiency::kUseWeights);
+      const Bool_t useBinPrior = eff.TestBit(TEfficiency::kUseBinPrior);
+      return {eff.fTotalHistogram->GetBinContent(bin),
+              eff.fPassedHistogram->GetBinContent(bin),
+              useWeights ? eff.fTotalHistogram->GetSumw2()->At(bin) : 0.,
+              useWeights ? eff.fPassedHistogram->GetSumw2()->At(bin) : 0.,
+              useBinPrior ? eff.GetBetaAlpha(bin) : eff.GetBetaAlpha(),
+              useBinPrior ? eff.GetBetaBeta(bin) : eff.GetBetaBeta()};
+   }
+};
+
 ClassImp(TEfficiency);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +234,7 @@ You can fill the TEfficiency object by calling the TEfficiency::Fill(Bool_t bPas
 The "bPassed" boolean flag indicates whether the current event is good
 (both histograms are filled) or not (only TEfficiency::fTotalHistogram is filled).
 The x, y and z variables determine the bin which is filled. For lower dimensions, the z- or even the y-value may be omitted.
+Arrays of events can be filled at once with TEfficiency::FillN, which is faster.
 
 Begin_Macro(source)
 {
@@ -1123,6 +1193,7 @@ TEfficiency::~TEfficiency()
    delete fPassedHistogram;
    delete fPaintGraph;
    delete fPaintHisto;
+   delete fIntervalCache;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1660,6 +1731,83 @@ Bool_t TEfficiency::CheckWeights(const TH1& pass,const TH1& total)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the confidence intervals of all bins at once.
+///
+/// The following calls to GetEfficiencyErrorLow and GetEfficiencyErrorUp return the
+/// stored intervals instead of computing them again, for all bins that have not changed
+/// since; the intervals of the bins that changed are recomputed by the next call to
+/// ComputeIntervals. With implicit multi-threading enabled (see ROOT::EnableImplicitMT),
+/// the intervals of many bins are computed in parallel.
+///
+/// This method is called by Paint, CreateGraph and CreateGraph2D: it speeds up drawing
+/// and exporting efficiencies with many bins, where computing the intervals, which for most
+/// statistic options needs quantiles of the beta distribution, takes most of the time.
+
+void TEfficiency::ComputeIntervals() const
+{
+   const Int_t ncells = fTotalHistogram->GetNcells();
+   if (ncells == 0) return;
+
+   // GetEfficiencyError* change the statistic option of weighted efficiencies not supporting it:
+   // do it now, before the settings are stored and the intervals are computed concurrently
+   if (TestBit(kUseWeights) && !TestBit(kIsBayesian) && fStatisticOption != kFNormal)
+      GetEfficiencyErrorLow(1);
+
+   if (!fIntervalCache) fIntervalCache = new TEfficiencyIntervalCache;
+   auto &cache = *fIntervalCache;
+   const auto settings = TEfficiencyIntervalCache::GetSettings(*this);
+   if (!(cache.fSettings == settings) || cache.fBins.size() != std::size_t(ncells)) {
+      const Double_t nan = std::numeric_limits<Double_t>::quiet_NaN();
+      cache.fSettings = settings;
+      // NaN inputs never compare equal: all bins are computed
+      cache.fBins.assign(ncells, {{nan, nan, nan, nan, nan, nan}, 0., 0.});
+   }
+
+   auto update = [&](Int_t begin, Int_t end) {
+      for (Int_t bin = begin; bin < end; ++bin) {
+         auto &entry = cache.fBins[bin];
+         const auto inputs = TEfficiencyIntervalCache::GetInputs(*this, bin);
+         if (entry.fInputs == inputs) continue;
+         // the getters do not use the entry of this bin while its inputs are outdated
+         entry.fErrLow = GetEfficiencyErrorLow(bin);
+         entry.fErrUp = GetEfficiencyErrorUp(bin);
+         entry.fInputs = inputs;
+      }
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && ncells > 1000) {
+      ROOT::TThreadExecutor pool;
+      const Int_t nChunks = std::min(ncells / 100, Int_t(4 * pool.GetPoolSize()));
+      pool.Foreach([&](Int_t chunk) { update(Long64_t(ncells) * chunk / nChunks, Long64_t(ncells) * (chunk + 1) / nChunks); },
+                   ROOT::TSeq<Int_t>(0, nChunks));
+      return;
+   }
+#endif
+   update(0, ncells);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the errors of bin computed by ComputeIntervals.
+///
+/// Returns false if they have not been computed, or if the bin or the settings of the
+/// TEfficiency have changed since.
+
+Bool_t TEfficiency::GetCachedInterval(Int_t bin, Double_t &errLow, Double_t &errUp) const
+{
+   if (!fIntervalCache || bin < 0 || std::size_t(bin) >= fIntervalCache->fBins.size())
+      return kFALSE;
+   if (!(fIntervalCache->fSettings == TEfficiencyIntervalCache::GetSettings(*this)))
+      return kFALSE;
+   const auto &entry = fIntervalCache->fBins[bin];
+   if (!(entry.fInputs == TEfficiencyIntervalCache::GetInputs(*this, bin)))
+      return kFALSE;
+   errLow = entry.fErrLow;
+   errUp = entry.fErrUp;
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create the graph used be painted (for dim=1 TEfficiency)
 /// The return object is managed by the caller
@@ -1710,6 +1858,8 @@ void TEfficiency::FillGraph2D(TGraph2DAsymmErrors * graph, Option_t * opt) const
    Bool_t plot0Bins = false;
    if (option.Contains("e0") ) plot0Bins = true;
 
+   ComputeIntervals();
+
    //point i corresponds to bin i+1 in histogram
    // point j is point graph index
    // LM: cannot use TGraph::SetPoint because it deletes the underlying
@@ -1813,6 +1963,8 @@ void TEfficiency::FillGraph(TGraphAsymmErrors * graph, Option_t * opt) const
    Bool_t plot0Bins = false;
    if (option.Contains("e0") ) plot0Bins = true;
 
+   ComputeIntervals();
+
    Double_t x,y,xlow,xup,ylow,yup;
    //point i corresponds to bin i+1 in histogram
    // point j is point graph index
@@ -2518,6 +2670,64 @@ void TEfficiency::FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the two histograms with arrays of events.
+///
+/// \param[in] n number of events
+/// \param[in] bPassed flags whether the events passed the selection
+/// \param[in] x x-values
+/// \param[in] y y-values (may be nullptr for 1-D efficiencies)
+/// \param[in] z z-values (may be nullptr for 1-D or 2-D efficiencies)
+/// \param[in] weight weights of the events, or nullptr for unweighted events
+///
+/// Gives the same result as calling Fill, or FillWeighted if weight is given, for each event,
+/// but the histograms are filled with TH1::FillN, which looks up the bins of many events at once.
+///
+/// Note: - this function will call SetUseWeightedEvents if weights are given and it was not called by the user before
+
+void TEfficiency::FillN(Int_t n,const Bool_t* bPassed,const Double_t* x,const Double_t* y,const Double_t* z,
+                        const Double_t* weight)
+{
+   const Int_t dim = GetDimension();
+   if ((dim > 1 && !y) || (dim > 2 && !z)) {
+      Error("FillN","the values of all %d dimensions must be given",dim);
+      return;
+   }
+   if (weight && !TestBit(kUseWeights))
+      SetUseWeightedEvents();
+
+   auto fillHistogram = [dim](TH1 *h, Int_t m, const Double_t *xx, const Double_t *yy, const Double_t *zz,
+                              const Double_t *ww) {
+      if (dim == 1)
+         h->FillN(m, xx, ww);
+      else if (dim == 2)
+         static_cast<TH2 *>(h)->FillN(m, xx, yy, ww);
+      else
+         static_cast<TH3 *>(h)->FillN(m, xx, yy, zz, ww);
+   };
+
+   fillHistogram(fTotalHistogram, n, x, y, z, weight);
+
+   // gather the events which passed in blocks
+   constexpr Int_t kBlockSize = 1024;
+   std::vector<Double_t> px(kBlockSize), py(dim > 1 ? kBlockSize : 0), pz(dim > 2 ? kBlockSize : 0);
+   std::vector<Double_t> pw(weight ? kBlockSize : 0);
+   for (Int_t begin = 0; begin < n; begin += kBlockSize) {
+      const Int_t end = std::min(n, begin + kBlockSize);
+      Int_t m = 0;
+      for (Int_t i = begin; i < end; ++i) {
+         if (!bPassed[i]) continue;
+         px[m] = x[i];
+         if (dim > 1) py[m] = y[i];
+         if (dim > 2) pz[m] = z[i];
+         if (weight) pw[m] = weight[i];
+         ++m;
+      }
+      if (m > 0)
+         fillHistogram(fPassedHistogram, m, px.data(), py.data(), pz.data(), weight ? pw.data() : nullptr);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the global bin number containing the given values
 ///
@@ -2724,13 +2934,17 @@ Double_t TEfficiency::GetEfficiency(Int_t bin) const
 ///
 /// The result depends on the current confidence level fConfLevel and the
 /// chosen statistic option fStatisticOption. See SetStatisticOption(Int_t) for
-/// more details.
+/// more details. The errors of all bins can be computed at once by ComputeIntervals.
 ///
 /// Note: If the histograms are filled with weights, only bayesian methods and the
 ///       normal approximation are supported.
 
 Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
 {
+   Double_t errLow, errUp;
+   if (GetCachedInterval(bin, errLow, errUp))
+      return errLow;
+
    Double_t total = fTotalHistogram->GetBinContent(bin);
    Double_t passed = fPassedHistogram->GetBinContent(bin);
 
@@ -2804,13 +3018,17 @@ Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
 ///
 /// The result depends on the current confidence level fConfLevel and the
 /// chosen statistic option fStatisticOption. See SetStatisticOption(Int_t) for
-/// more details.
+/// more details. The errors of all bins can be computed at once by ComputeIntervals.
 ///
 /// Note: If the histograms are filled with weights, only bayesian methods and the
 ///       normal approximation are supported.
 
 Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
 {
+   Double_t errLow, errUp;
+   if (GetCachedInterval(bin, errLow, errUp))
+      return errUp;
+
    Double_t total = fTotalHistogram->GetBinContent(bin);
    Double_t passed = fPassedHistogram->GetBinContent(bin);
 
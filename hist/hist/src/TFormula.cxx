@@ -753,6 +753,7 @@ void TFormula::Copy(TObject &obj) const
    fnew.fMethod.reset(m);
 
    fnew.fFuncPtr = fFuncPtr;
+   fnew.fBatchFuncPtr = fBatchFuncPtr.load();
    fnew.fGradGenerationInput = fGradGenerationInput;
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
@@ -773,6 +774,7 @@ void TFormula::Clear(Option_t * )
    fClingName = "";
 
    fMethod.reset();
+   fBatchFuncPtr = nullptr;
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -870,6 +872,51 @@ bool TFormula::PrepareEvalMethod()
    return fFuncPtr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compiles the loop used by the batch EvalPar, or finds it in the global map of
+/// functions when another formula with the same expression compiled it already.
+/// Returns false if the formula cannot be evaluated in a batch, e.g. because it is
+/// vectorized, a lambda expression, or not compiled yet.
+
+Bool_t TFormula::PrepareBatchEvalMethod() const
+{
+   if (fBatchFuncPtr)
+      return true;
+   if (!fReadyToExecute || !fClingInitialized || fVectorized || fNdim == 0 || TestBit(TFormula::kLambda))
+      return false;
+
+   // the body of the function, which is also the key in the global map: x is the point
+   // being evaluated and p the parameters, as in the expression passed to Cling
+   TString body = TString::Format("(Double_t *xs, %sInt_t n, Double_t *result) {\n"
+                                  "   for (Int_t i = 0; i < n; ++i) {\n"
+                                  "      Double_t *x = xs + i * %d;\n"
+                                  "      result[i] = %s;\n"
+                                  "   }\n"
+                                  "}",
+                                  (fNpar > 0 ? "Double_t *p, " : ""), fNdim, GetExpFormula("CLING").Data());
+   std::string key(body.Data());
+
+   R__LOCKGUARD(gROOTMutex);
+   auto funcit = gClingFunctions.find(key);
+   if (funcit == gClingFunctions.end()) {
+      auto hasher = gClingFunctions.hash_function();
+      TString name = TString::Format("%s_batch__id%zu", gNamePrefix.Data(), hasher(key));
+      CallFuncSignature funcPtr = nullptr;
+      if (gCling->Declare(TString("#pragma cling optimize(2)\nvoid ") + name + body)) {
+         TMethodCall method;
+         method.InitWithPrototype(name, fNpar > 0 ? "Double_t*,Double_t*,Int_t,Double_t*" : "Double_t*,Int_t,Double_t*");
+         if (method.IsValid())
+            funcPtr = prepareFuncPtr(&method);
+      }
+      if (!funcPtr)
+         Warning("EvalPar", "Cannot compile the batch evaluation of %s, evaluating point by point", GetName());
+      // failures are stored as well, not to try again for every batch
+      funcit = gClingFunctions.insert(std::make_pair(key, (void *)funcPtr)).first;
+   }
+   fBatchFuncPtr = (CallFuncSignature)funcit->second;
+   return fBatchFuncPtr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///    Inputs formula, transfered to C++ code into Cling
 
@@ -2313,6 +2360,7 @@ void TFormula::ProcessFormula(TString &formula)
 
          // set the name for Cling using the hash_function
          fClingName = gNamePrefix;
+         fBatchFuncPtr = nullptr;
 
          // check if formula exist already in the map
          R__LOCKGUARD(gROOTMutex);
@@ -3063,6 +3111,7 @@ void TFormula::SetVectorized(Bool_t vectorized)
       fClingInput = fFormula;
 
       fMethod.reset();
+      fBatchFuncPtr = nullptr;
 
       FillVecFunctionsShurtCuts();   // to replace with the right vectorized signature (e.g. sin  -> vecCore::math::Sin)
       PreProcessFormula(fFormula);
@@ -3118,6 +3167,44 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at n points.
+///
+/// The coordinates of point i are x[i * ndim], ..., x[i * ndim + ndim - 1], with
+/// ndim = GetNdim(), and its value is stored in result[i]. The parameters params
+/// are used for all points, or the parameters of the formula if nullptr.
+///
+/// The results are the same as calling EvalPar for each point up to rounding: the
+/// loop over the points is compiled together with the expression and with
+/// optimization, so that the compiler can inline and vectorize it, and may e.g.
+/// contract multiplications and additions differently than for a single point.
+/// The call through the interpreter wrapper happens once per batch. Like the
+/// expression itself, the compiled loop is shared by all formulas with the same
+/// expression. Vectorized formulas and lambda expressions are evaluated point by
+/// point.
+
+void TFormula::EvalPar(const Double_t *x, Int_t n, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0)
+      return;
+   if (!x || !PrepareBatchEvalMethod()) {
+      for (Int_t i = 0; i < n; ++i)
+         result[i] = EvalPar(x ? x + i * fNdim : nullptr, params);
+      return;
+   }
+
+   void *args[4];
+   Int_t nargs = 0;
+   double *vars = const_cast<double *>(x);
+   double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+   args[nargs++] = &vars;
+   if (fNpar > 0)
+      args[nargs++] = &pars;
+   args[nargs++] = &n;
+   args[nargs++] = &result;
+   (*fBatchFuncPtr.load())(nullptr, nargs, args, nullptr);
+}
+
 bool TFormula::fIsCladRuntimeIncluded = false;
 
 static bool functionExists(const string &Name) {
@@ -33,13 +33,16 @@
 #include "TPluginManager.h"
 #include "strtok.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <cassert>
 #include <iostream>
 #include <fstream>
 #include <cstring>
+#include <memory>
 #include <numeric>
+#include <vector>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -269,6 +272,7 @@ TGraph& TGraph::operator=(const TGraph &gr)
 
       fMinimum = gr.fMinimum;
       fMaximum = gr.fMaximum;
+      ResetEvalSpline();
       if (fX) delete [] fX;
       if (fY) delete [] fY;
       if (!fMaxSize) {
@@ -582,6 +586,7 @@ TGraph::~TGraph()
       fFunctions = nullptr; //to avoid accessing a deleted object in RecursiveRemove
    }
    delete fHistogram;
+   ResetEvalSpline();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -622,6 +627,7 @@ Double_t** TGraph::AllocateArrays(Int_t Narrays, Int_t arraySize)
 void TGraph::Add(TF1 *f, Double_t c1)
 {
    if (fHistogram) SetBit(kResetHisto);
+   ResetEvalSpline();
 
    for (Int_t i = 0; i < fNpoints; i++) {
       fY[i] += c1*f->Eval(fX[i], fY[i]);
@@ -638,6 +644,7 @@ void TGraph::Add(TF1 *f, Double_t c1)
 void TGraph::Apply(TF1 *f)
 {
    if (fHistogram) SetBit(kResetHisto);
+   ResetEvalSpline();
 
    for (Int_t i = 0; i < fNpoints; i++) {
       fY[i] = f->Eval(fX[i], fY[i]);
@@ -935,6 +942,73 @@ void TGraph::DrawPanel()
    if (painter) painter->DrawPanelHelper(this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Spline kept by TGraph::GetEvalSpline, with the points it was built from.
+
+struct TGraph::TEvalSplineCache {
+   std::vector<Double_t> fX;
+   std::vector<Double_t> fY;
+   std::unique_ptr<TSpline3> fSpline;
+   std::unique_ptr<TEvalSplineCache> fReplaced; ///< Outdated cache that other threads may still be reading
+
+   Bool_t Matches(Int_t n, const Double_t *x, const Double_t *y) const
+   {
+      return Int_t(fX.size()) == n && std::memcmp(fX.data(), x, n * sizeof(Double_t)) == 0 &&
+             std::memcmp(fY.data(), y, n * sizeof(Double_t)) == 0;
+   }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the TSpline3 through the points of this graph, used by Eval with option "S".
+///
+/// The spline is built by the first call and kept with a copy of the points. It is reused
+/// as long as the points are the same, also if they are changed through GetX() or GetY().
+/// Concurrent calls may build the spline more than once, but all of them return the same
+/// spline. A spline built for points that changed since stays allocated until the next
+/// TGraph::ResetEvalSpline, as a concurrent call may still use it.
+
+const TSpline3 &TGraph::GetEvalSpline() const
+{
+   TEvalSplineCache *current = fEvalSpline.load(std::memory_order_acquire);
+   if (current && current->Matches(fNpoints, fX, fY))
+      return *current->fSpline;
+
+   auto cache = std::make_unique<TEvalSplineCache>();
+   cache->fX.assign(fX, fX + fNpoints);
+   cache->fY.assign(fY, fY + fNpoints);
+   // points must be sorted before using a TSpline
+   std::vector<Double_t> xsort(fNpoints);
+   std::vector<Double_t> ysort(fNpoints);
+   std::vector<Int_t> indxsort(fNpoints);
+   TMath::Sort(fNpoints, fX, &indxsort[0], false);
+   for (Int_t i = 0; i < fNpoints; ++i) {
+      xsort[i] = fX[ indxsort[i] ];
+      ysort[i] = fY[ indxsort[i] ];
+   }
+   cache->fSpline = std::make_unique<TSpline3>("", &xsort[0], &ysort[0], fNpoints);
+   while (true) {
+      cache->fReplaced.reset(current);
+      if (fEvalSpline.compare_exchange_strong(current, cache.get(), std::memory_order_acq_rel))
+         return *cache.release()->fSpline;
+      // another thread was faster, current is now its cache
+      cache->fReplaced.release();
+      if (current && current->Matches(fNpoints, fX, fY))
+         return *current->fSpline;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the spline kept by TGraph::Eval with option "S".
+///
+/// Called by the methods that change the points and by the destructor. Points changed
+/// directly in fX or fY are detected by TGraph::GetEvalSpline, calling this function
+/// in addition releases the memory of the outdated splines.
+
+void TGraph::ResetEvalSpline()
+{
+   delete fEvalSpline.exchange(nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interpolate points in this graph at x using a TSpline.
 ///
@@ -943,12 +1017,16 @@ void TGraph::DrawPanel()
 ///    extrapolation is computed.
 ///  - if spline==0 and option="S" a TSpline3 object is created using this graph
 ///    and the interpolated value from the spline is returned.
-///    the internally created spline is deleted on return.
+///    The spline is kept and reused by the following calls until the points are
+///    changed with the methods of TGraph, e.g. SetPoint, Set or RemovePoint. Points
+///    changed through the arrays returned by GetX() and GetY() are not noticed.
 ///  - if spline is specified, it is used to return the interpolated value.
 ///
 ///   If the points are sorted in X a binary search is used (significantly faster)
 ///   One needs to set the bit  TGraph::SetBit(TGraph::kIsSortedX) before calling
 ///   TGraph::Eval to indicate that the graph is sorted in X.
+///
+///   To interpolate at many points, TGraph::EvalN is faster.
 
 Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 {
@@ -964,24 +1042,9 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    if (option && *option) {
       TString opt = option;
       opt.ToLower();
-      // create a TSpline every time when using option "s" and no spline pointer is given
-      if (opt.Contains("s")) {
-
-         // points must be sorted before using a TSpline
-         std::vector<Double_t> xsort(fNpoints);
-         std::vector<Double_t> ysort(fNpoints);
-         std::vector<Int_t> indxsort(fNpoints);
-         TMath::Sort(fNpoints, fX, &indxsort[0], false);
-         for (Int_t i = 0; i < fNpoints; ++i) {
-            xsort[i] = fX[ indxsort[i] ];
-            ysort[i] = fY[ indxsort[i] ];
-         }
-
-         // spline interpolation creating a new spline
-         TSpline3 s("", &xsort[0], &ysort[0], fNpoints);
-         Double_t result = s.Eval(x);
-         return result;
-      }
+      // use a TSpline through the points when using option "s" and no spline pointer is given
+      if (opt.Contains("s"))
+         return GetEvalSpline().Eval(x);
    }
    //linear interpolation
    //In case x is < fX[0] or > fX[fNpoints-1] return the extrapolated point
@@ -1042,6 +1105,66 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    return yn;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate points in this graph at the n abscissas x and store the values in y.
+///
+/// Gives the same result as calling TGraph::Eval(x[i], spline, option) for each value,
+/// with the same meaning of spline and option, but:
+///  - the spline given or built with option "S" is evaluated with TSpline::EvalN;
+///  - for a graph sorted in X (see TGraph::Eval), the interval of the previous value
+///    is tried first before doing a binary search. The abscissas need not be sorted,
+///    but sorted or clustered values are interpolated faster.
+
+void TGraph::EvalN(Int_t n, const Double_t *x, Double_t *y, TSpline *spline, Option_t *option) const
+{
+   if (spline) {
+      spline->EvalN(n, x, y);
+      return;
+   }
+   if (fNpoints <= 1) {
+      std::fill(y, y + n, fNpoints == 1 ? fY[0] : 0.);
+      return;
+   }
+   if (option && *option) {
+      TString opt = option;
+      opt.ToLower();
+      if (opt.Contains("s")) {
+         GetEvalSpline().EvalN(n, x, y);
+         return;
+      }
+   }
+   if (!TestBit(TGraph::kIsSortedX)) {
+      for (Int_t i = 0; i < n; ++i)
+         y[i] = Eval(x[i]);
+      return;
+   }
+
+   Int_t low = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      if (fX[low] < xi && xi < fX[low+1]) {
+         // same interval as the previous value
+      } else if (low+2 < fNpoints && fX[low+1] < xi && xi < fX[low+2]) {
+         ++low;
+      } else {
+         // same as in TGraph::Eval
+         low = TMath::BinarySearch(fNpoints, fX, xi);
+         if (low == -1) low = 0;
+         if (fX[low] == xi) {
+            y[i] = fY[low];
+            if (low == fNpoints-1) low--;
+            continue;
+         }
+         if (low == fNpoints-1) low--;
+      }
+      const Int_t up = low+1;
+      if (fX[low] == fX[up])
+         y[i] = fY[low];
+      else
+         y[i] = fY[up] + (xi - fX[up]) * (fY[low] - fY[up]) / (fX[low] - fX[up]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -1763,6 +1886,7 @@ void TGraph::InsertPointBefore(Int_t ipoint, Double_t x, Double_t y)
        return;
    }
 
+   ResetEvalSpline();
    Double_t **ps = ExpandAndCopy(fNpoints + 1, ipoint);
    CopyAndRelease(ps, ipoint, fNpoints++, ipoint + 1);
 
@@ -2067,6 +2191,7 @@ Int_t TGraph::RemovePoint(Int_t ipoint)
    if ((ipoint < 0) || (ipoint >= fNpoints))
       return -1;
 
+   ResetEvalSpline();
    Double_t **ps = ShrinkAndCopy(fNpoints - 1, ipoint);
    CopyAndRelease(ps, ipoint + 1, fNpoints--, ipoint);
    if (gPad) gPad->Modified();
@@ -2258,6 +2383,7 @@ void TGraph::SaveHistogramAndFunctions(std::ostream &out, const char *varname, I
 
 void TGraph::Scale(Double_t c1, Option_t *option)
 {
+   ResetEvalSpline();
    TString opt = option; opt.ToLower();
    if (opt.Contains("x")) {
       for (Int_t i=0; i<GetN(); i++)
@@ -2278,6 +2404,7 @@ void TGraph::Set(Int_t n)
 {
    if (n < 0) n = 0;
    if (n == fNpoints) return;
+   ResetEvalSpline();
    Double_t **ps = Allocate(n);
    CopyAndRelease(ps, 0, TMath::Min(fNpoints, n), 0);
    if (n > fNpoints) {
@@ -2343,6 +2470,7 @@ void TGraph::SetPoint(Int_t i, Double_t x, Double_t y)
 {
    if (i < 0) return;
    if (fHistogram) SetBit(kResetHisto);
+   ResetEvalSpline();
 
    if (i >= fMaxSize) {
       Double_t **ps = ExpandAndCopy(i + 1, fNpoints);
@@ -2516,6 +2644,7 @@ void TGraph::Sort(Bool_t (*greaterfunc)(const TGraph *, Int_t, Int_t) /*=TGraph:
 void TGraph::Streamer(TBuffer &b)
 {
    if (b.IsReading()) {
+      ResetEvalSpline();
       UInt_t R__s, R__c;
       Version_t R__v = b.ReadVersion(&R__s, &R__c);
       if (R__v > 2) {
@@ -2584,6 +2713,7 @@ void TGraph::SwapPoints(Int_t pos1, Int_t pos2)
 {
    SwapValues(fX, pos1, pos2);
    SwapValues(fY, pos1, pos2);
+   ResetEvalSpline();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2603,6 +2733,7 @@ void TGraph::UpdateArrays(const std::vector<Int_t> &sorting_indices, Int_t numSo
    // Copy the sorted X and Y values back to the original arrays
    std::copy(fXSorted.begin(), fXSorted.end(), fX + low);
    std::copy(fYSorted.begin(), fYSorted.end(), fY + low);
+   ResetEvalSpline();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
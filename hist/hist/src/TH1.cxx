@@ -19,6 +19,7 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <vector>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -54,6 +55,7 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include "TH1Merger.h"
+#include "TH1ConcurrentFill.h"
 
 /** \addtogroup Histograms
 @{
@@ -373,6 +375,10 @@ When using the options 2 or 3 above, the labels are automatically
  capacity (127 or 32767). Histograms of all types may have positive
  or/and negative bin contents.
 
+ Histograms of doubles or floats can be filled from several threads at
+ the same time after calling TH1::SetConcurrentFill, without one copy
+ of the histogram per thread.
+
 \anchor associated-errors
 ### Associated errors
  By default, for each bin, the sum of weights is computed at fill time.
@@ -619,6 +625,7 @@ TH1::TH1(): TNamed(), TAttLine(), TAttFill(), TAttMarker()
    fNcells        = 0;
    fIntegral      = nullptr;
    fPainter       = nullptr;
+   fConcurrentFill = nullptr;
    fEntries       = 0;
    fNormFactor    = 0;
    fTsumw         = fTsumw2=fTsumwx=fTsumwx2=0;
@@ -649,6 +656,8 @@ TH1::~TH1()
    fIntegral = nullptr;
    delete[] fBuffer;
    fBuffer = nullptr;
+   delete fConcurrentFill;
+   fConcurrentFill = nullptr;
    if (fFunctions) {
       R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -773,6 +782,7 @@ void TH1::Build()
    fDirectory     = nullptr;
    fPainter       = nullptr;
    fIntegral      = nullptr;
+   fConcurrentFill = nullptr;
    fEntries       = 0;
    fNormFactor    = 0;
    fTsumw         = fTsumw2=fTsumwx=fTsumwx2=0;
@@ -2700,6 +2710,15 @@ void TH1::Copy(TObject &obj) const
       // obj.fBuffer has been deleted before
       ((TH1&)obj).fBuffer    = buf;
    }
+   // the statistics of the threads filling concurrently are copied with the histogram ones
+   if (fConcurrentFill) fConcurrentFill->Fold();
+   // the pending statistics of the target are overwritten, and its bin contents may be reallocated below:
+   // its concurrent fill mode is set up again at the end
+   const Bool_t targetConcurrentFill = ((TH1&)obj).fConcurrentFill != nullptr;
+   if (targetConcurrentFill) {
+      ((TH1&)obj).fConcurrentFill->Clear();
+      ((TH1&)obj).SetConcurrentFill(kFALSE);
+   }
 
    // copy bin contents (this should be done by the derived classes, since TH1 does not store the bin content)
    // Do this in case derived from TArray
@@ -2745,6 +2764,7 @@ void TH1::Copy(TObject &obj) const
    } else
       ((TH1&)obj).fDirectory = nullptr;
 
+   if (targetConcurrentFill) ((TH1&)obj).SetConcurrentFill();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3346,6 +3366,7 @@ TH1* TH1::FFT(TH1* h_output, Option_t *option)
 Int_t TH1::Fill(Double_t x)
 {
    if (fBuffer)  return BufferFill(x,1);
+   if (fConcurrentFill) return TH1::Fill(x, 1.);
 
    Int_t bin;
    fEntries++;
@@ -3379,6 +3400,11 @@ Int_t TH1::Fill(Double_t x, Double_t w)
 {
 
    if (fBuffer) return BufferFill(x,w);
+   if (fConcurrentFill) {
+      const Int_t bin = fXaxis.FindFixBin(x);
+      const Bool_t inStats = (bin > 0 && bin <= fXaxis.GetNbins()) || GetStatOverflowsBehaviour();
+      return fConcurrentFill->Fill(bin, inStats, w, x);
+   }
 
    Int_t bin;
    fEntries++;
@@ -3448,6 +3474,11 @@ Int_t TH1::Fill(const char *namex, Double_t w)
 
 void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
+   if (fConcurrentFill) {
+      for (Int_t i = 0; i < ntimes; ++i)
+         TH1::Fill(x[i*stride], w ? w[i*stride] : 1.);
+      return;
+   }
    //If a buffer is activated, fill buffer
    if (fBuffer) {
       ntimes *= stride;
@@ -3476,6 +3507,13 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
 {
    Int_t bin,i;
 
+   if (ntimes <= 0) return;
+   if (!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) {
+      // the axis cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes(ntimes, x, w, stride);
+      return;
+   }
+
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
@@ -3498,6 +3536,59 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill histogram content from a vector when the axis cannot be extended.
+///
+/// Gives the same result as TH1::Fill called for each entry, but the bins are found for
+/// all entries at once by TAxis::FindFixBinN and the statistics are accumulated in local
+/// variables, which the compiler can keep in registers.
+
+void TH1::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
+{
+   fEntries += ntimes;
+   // Sumw2 must be called before the first weight different from 1 is added. Calling it before
+   // the unit weights that may precede it gives the same result, since their w^2 equals their w.
+   if (!fSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   const Int_t blockSize = std::min(kBlockSize, ntimes);
+   std::vector<Int_t> bins(blockSize);
+
+   const Int_t nbins = fXaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, bins.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t bin = bins[i];
+         const Double_t xx = xblock[i*stride];
+         const Double_t ww = wblock ? wblock[i*stride] : 1.;
+         if (sumw2) sumw2[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (!statOverflows && (bin == 0 || bin > nbins)) continue;
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*xx;
+         tsumwx2 += ww*xx*xx;
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
 ///
@@ -4424,6 +4515,7 @@ Bool_t TH1::GetDefaultSumw2()
 
 Double_t TH1::GetEntries() const
 {
+   if (fConcurrentFill) fConcurrentFill->Fold();
    if (fBuffer) {
       Int_t nentries = (Int_t) fBuffer[0];
       if (nentries > 0) return nentries;
@@ -6986,6 +7078,7 @@ void TH1::Streamer(TBuffer &b)
       b.CheckByteCount(R__s, R__c, TH1::IsA());
 
    } else {
+      if (fConcurrentFill) fConcurrentFill->Fold();
       b.WriteClassBuffer(TH1::Class(),this);
    }
 }
@@ -7127,6 +7220,7 @@ void TH1::Reset(Option_t *option)
    fTsumwx      = 0;
    fTsumwx2     = 0;
    fEntries     = 0;
+   if (fConcurrentFill) fConcurrentFill->Clear();
 
    if (opt == "ICES") return;
 
@@ -7826,6 +7920,7 @@ Double_t TH1::GetKurtosis(Int_t axis) const
 void TH1::GetStats(Double_t *stats) const
 {
    if (fBuffer) ((TH1*)this)->BufferEmpty();
+   if (fConcurrentFill) fConcurrentFill->Fold();
 
    // Loop on bins (possibly including underflows/overflows)
    Int_t bin, binx;
@@ -7876,6 +7971,8 @@ void TH1::GetStats(Double_t *stats) const
 
 void TH1::PutStats(Double_t *stats)
 {
+   // the entries of the threads filling concurrently are kept, their sums are replaced with the others
+   if (fConcurrentFill) fConcurrentFill->Fold();
    fTsumw   = stats[0];
    fTsumw2  = stats[1];
    fTsumwx  = stats[2];
@@ -7894,6 +7991,8 @@ void TH1::PutStats(Double_t *stats)
 
 void TH1::ResetStats()
 {
+   // fold before fTsumw is cleared, GetStats would add the statistics of the threads to it otherwise
+   if (fConcurrentFill) fConcurrentFill->Fold();
    Double_t stats[kNstat] = {0};
    fTsumw = 0;
    fEntries = 1; // to force re-calculation of the statistics in TH1::GetStats
@@ -8395,6 +8494,66 @@ void TH1::SetContent(const Double_t *content)
    for (Int_t i = 0; i < fNcells; ++i) UpdateBinContent(i, content[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the concurrent fill mode.
+///
+/// In this mode the Fill and FillN functions taking numeric coordinates can be called
+/// from several threads at the same time on the same histogram: the bin contents and
+/// the sums of squares of weights are incremented with atomic operations, while each
+/// thread accumulates the statistics (entries, sums of weights, of weight*x, ...) in
+/// its own variables. This replaces one histogram copy per thread, e.g. with
+/// ROOT::TThreadedObject, by one shared histogram, which matters for large 2-D and
+/// 3-D histograms:
+/// ~~~ {.cpp}
+///    TH3D h("h", "h", 500, 0, 1, 500, 0, 1, 200, 0, 1);
+///    h.Sumw2(); // needed when filling with weights
+///    h.SetConcurrentFill();
+///    ROOT::TThreadExecutor pool;
+///    pool.Foreach([&](int i) { h.Fill(x[i], y[i], z[i], w[i]); }, ROOT::TSeq<int>(n));
+///    h.SetConcurrentFill(kFALSE);
+/// ~~~
+/// The statistics of the threads are added to the ones of the histogram when they are
+/// read (GetEntries, GetStats and the functions using them such as GetMean), when the
+/// histogram is copied or written and when the mode is disabled. Functions other than
+/// Fill and FillN must not be called while other threads are filling.
+///
+/// The mode is only available for histograms storing doubles or floats, excluding
+/// profiles, and whose axes cannot be extended. The sum of squares of weights is not
+/// created automatically by a weighted fill in this mode: call Sumw2 before filling.
+
+void TH1::SetConcurrentFill(Bool_t on)
+{
+   if (!on) {
+      if (fConcurrentFill) {
+         fConcurrentFill->Fold();
+         delete fConcurrentFill;
+         fConcurrentFill = nullptr;
+      }
+      return;
+   }
+   if (fConcurrentFill) return;
+
+   if (!TH1ConcurrentFill::IsAvailable()) {
+      Error("SetConcurrentFill", "concurrent filling needs atomic operations on floating point values, which are not "
+                                 "available with this compiler");
+      return;
+   }
+   TArrayD *arrayD = dynamic_cast<TArrayD *>(this);
+   TArrayF *arrayF = dynamic_cast<TArrayF *>(this);
+   if ((!arrayD && !arrayF) || InheritsFrom(TProfile::Class()) || InheritsFrom("TProfile2D") ||
+       InheritsFrom("TProfile3D") || InheritsFrom("TH2Poly") || InheritsFrom("TH1K")) {
+      Error("SetConcurrentFill", "concurrent filling is only supported for histograms of doubles or floats");
+      return;
+   }
+   // the buffer fixes the axis limits of histograms with automatic binning
+   if (fBuffer) BufferEmpty(1);
+   if (fXaxis.CanExtend() || (fDimension > 1 && fYaxis.CanExtend()) || (fDimension > 2 && fZaxis.CanExtend())) {
+      Error("SetConcurrentFill", "concurrent filling is not supported for histograms with extendable axes");
+      return;
+   }
+   fConcurrentFill = new TH1ConcurrentFill(*this, arrayD, arrayF);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return contour values into array levels if pointer levels is non zero.
 ///
@@ -0,0 +1,203 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Helper class implementing the concurrent fill mode of TH1, see TH1::SetConcurrentFill
+
+#ifndef ROOT_TH1ConcurrentFill
+#define ROOT_TH1ConcurrentFill
+
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+class TH1ConcurrentFill {
+public:
+   /// Statistics accumulated by one filling thread, in the layout of TH1::GetStats.
+   /// Aligned to a cache line so that threads do not write to the same one.
+   struct alignas(64) TThreadStats {
+      Double_t fEntries = 0;
+      Double_t fStats[TH1::kNstat] = {};
+
+      void Add(Double_t w, Double_t x)
+      {
+         fStats[0] += w;
+         fStats[1] += w * w;
+         fStats[2] += w * x;
+         fStats[3] += w * x * x;
+      }
+      void Add(Double_t w, Double_t x, Double_t y)
+      {
+         Add(w, x);
+         fStats[4] += w * y;
+         fStats[5] += w * y * y;
+         fStats[6] += w * x * y;
+      }
+      void Add(Double_t w, Double_t x, Double_t y, Double_t z)
+      {
+         Add(w, x, y);
+         fStats[7] += w * z;
+         fStats[8] += w * z * z;
+         fStats[9] += w * x * z;
+         fStats[10] += w * y * z;
+      }
+   };
+
+private:
+   TH1 &fHist;
+   TArrayD *fArrayD;    ///< Bin contents of histograms of doubles, or nullptr
+   TArrayF *fArrayF;    ///< Bin contents of histograms of floats, or nullptr
+   const ULong64_t fId; ///< Never reused, identifies this object in the per-thread caches
+   std::mutex fMutex;   ///< Protects fThreadStats
+   std::unordered_map<std::thread::id, std::unique_ptr<TThreadStats>> fThreadStats;
+   std::atomic<bool> fWarnedSumw2{false};
+
+   static ULong64_t NextId()
+   {
+      static std::atomic<ULong64_t> gId{0};
+      return ++gId;
+   }
+
+   /// Add value to *address atomically. The bin contents are plain arrays: before C++20 (std::atomic_ref) only the
+   /// GCC and Clang builtins can operate on them atomically.
+   template <typename T>
+   static void AtomicAdd(T *address, T value)
+   {
+#if defined(__cpp_lib_atomic_ref)
+      std::atomic_ref<T>(*address).fetch_add(value, std::memory_order_relaxed);
+#elif defined(__GNUC__)
+      // __atomic_fetch_add does not take floating point types, the generic compare-exchange does
+      T old;
+      __atomic_load(address, &old, __ATOMIC_RELAXED);
+      T desired = old + value;
+      while (!__atomic_compare_exchange(address, &old, &desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+         desired = old + value;
+#else
+      // never called, see IsAvailable()
+      *address += value;
+#endif
+   }
+
+   TThreadStats &CreateThreadStats()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto &stats = fThreadStats[std::this_thread::get_id()];
+      if (!stats)
+         stats.reset(new TThreadStats);
+      return *stats;
+   }
+
+   void AddBinContent(Int_t bin, Double_t w)
+   {
+      if (fArrayD)
+         AtomicAdd(fArrayD->fArray + bin, w);
+      else
+         AtomicAdd(fArrayF->fArray + bin, Float_t(w));
+      // Sumw2 cannot be triggered while other threads are filling
+      if (fHist.fSumw2.fN)
+         AtomicAdd(fHist.fSumw2.fArray + bin, w * w);
+      else if (w != 1. && !fHist.TestBit(TH1::kIsNotW) && !fWarnedSumw2.exchange(true))
+         fHist.Warning("Fill", "Sumw2 must be called before filling concurrently with weights, "
+                               "the sum of squares of weights is not stored");
+   }
+
+   /// The statistics of the calling thread. A small direct-mapped cache per thread avoids taking the lock
+   /// except for the first fill of a thread and when a thread fills many histograms in turn.
+   TThreadStats &GetThreadStats()
+   {
+      thread_local std::pair<ULong64_t, TThreadStats *> cache[8] = {};
+      auto &entry = cache[fId % 8];
+      if (entry.first != fId)
+         entry = {fId, &CreateThreadStats()};
+      return *entry.second;
+   }
+
+public:
+   /// Whether AtomicAdd is atomic with this compiler; TH1::SetConcurrentFill refuses the mode otherwise.
+   static constexpr bool IsAvailable()
+   {
+#if defined(__cpp_lib_atomic_ref) || defined(__GNUC__)
+      return true;
+#else
+      return false;
+#endif
+   }
+
+   TH1ConcurrentFill(TH1 &h, TArrayD *arrayD, TArrayF *arrayF)
+      : fHist(h), fArrayD(arrayD), fArrayF(arrayF), fId(NextId())
+   {
+   }
+   TH1ConcurrentFill(const TH1ConcurrentFill &) = delete;
+   TH1ConcurrentFill &operator=(const TH1ConcurrentFill &) = delete;
+
+   /// Add w to the bin content and the sum of squares of weights with atomic operations, and the entry to the
+   /// statistics of the calling thread if inStats. Returns bin if the entry is in the statistics, -1 otherwise,
+   /// as TH1::Fill.
+   template <typename... Coords>
+   Int_t Fill(Int_t bin, Bool_t inStats, Double_t w, Coords... xyz)
+   {
+      TThreadStats &stats = GetThreadStats();
+      stats.fEntries++;
+      if (bin < 0)
+         return -1;
+      AddBinContent(bin, w);
+      if (!inStats)
+         return -1;
+      stats.Add(w, xyz...);
+      return bin;
+   }
+
+   /// Add the statistics of all threads to the histogram and reset them.
+   /// Must not run concurrently with Fill.
+   void Fold()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      TThreadStats sum;
+      for (auto &threadStats : fThreadStats) {
+         sum.fEntries += threadStats.second->fEntries;
+         for (Int_t i = 0; i < TH1::kNstat; ++i)
+            sum.fStats[i] += threadStats.second->fStats[i];
+         *threadStats.second = TThreadStats();
+      }
+      fHist.fEntries += sum.fEntries;
+      fHist.fTsumw += sum.fStats[0];
+      fHist.fTsumw2 += sum.fStats[1];
+      fHist.fTsumwx += sum.fStats[2];
+      fHist.fTsumwx2 += sum.fStats[3];
+      if (auto h2 = dynamic_cast<TH2 *>(&fHist)) {
+         h2->fTsumwy += sum.fStats[4];
+         h2->fTsumwy2 += sum.fStats[5];
+         h2->fTsumwxy += sum.fStats[6];
+      } else if (auto h3 = dynamic_cast<TH3 *>(&fHist)) {
+         h3->fTsumwy += sum.fStats[4];
+         h3->fTsumwy2 += sum.fStats[5];
+         h3->fTsumwxy += sum.fStats[6];
+         h3->fTsumwz += sum.fStats[7];
+         h3->fTsumwz2 += sum.fStats[8];
+         h3->fTsumwxz += sum.fStats[9];
+         h3->fTsumwyz += sum.fStats[10];
+      }
+   }
+
+   /// Discard the statistics of all threads, e.g. when the histogram is reset.
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (auto &threadStats : fThreadStats)
+         *threadStats.second = TThreadStats();
+   }
+};
+
+#endif
@@ -27,6 +27,9 @@
 #include "TObjArray.h"
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
+#include "TH1ConcurrentFill.h"
+
+#include <vector>
 
 ClassImp(TH2);
 
@@ -415,6 +418,7 @@ Int_t TH2::Fill(Double_t )
 Int_t TH2::Fill(Double_t x,Double_t y)
 {
    if (fBuffer) return BufferFill(x,y,1);
+   if (fConcurrentFill) return TH2::Fill(x, y, 1.);
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -459,6 +463,13 @@ Int_t TH2::Fill(Double_t x,Double_t y)
 Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,w);
+   if (fConcurrentFill) {
+      const Int_t binx = fXaxis.FindFixBin(x);
+      const Int_t biny = fYaxis.FindFixBin(y);
+      const Bool_t inStats = (binx > 0 && binx <= fXaxis.GetNbins() && biny > 0 && biny <= fYaxis.GetNbins()) ||
+                             GetStatOverflowsBehaviour();
+      return fConcurrentFill->Fill(biny*(fXaxis.GetNbins()+2) + binx, inStats, w, x, y);
+   }
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -646,6 +657,11 @@ Int_t TH2::Fill(Double_t x, const char *namey, Double_t w)
 void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
    Int_t binx, biny, bin, i;
+   if (fConcurrentFill) {
+      for (i = 0; i < ntimes; ++i)
+         TH2::Fill(x[i*stride], y[i*stride], w ? w[i*stride] : 1.);
+      return;
+   }
    ntimes *= stride;
    Int_t ifirst = 0;
 
@@ -664,6 +680,12 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
+   if ((!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) && (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric())) {
+      // the axes cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes((ntimes-ifirst)/stride, &x[ifirst], &y[ifirst], w ? &w[ifirst] : nullptr, stride);
+      return;
+   }
+
    Double_t ww = 1;
    for (i=ifirst;i<ntimes;i+=stride) {
       fEntries++;
@@ -692,6 +714,69 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill a 2-D histogram from arrays when the axes cannot be extended.
+///
+/// Gives the same result as TH2::Fill called for each entry, see TH1::DoFillNFixedAxes.
+
+void TH2::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
+{
+   if (ntimes <= 0) return;
+   fEntries += ntimes;
+   if (!fSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   const Int_t blockSize = std::min(kBlockSize, ntimes);
+   std::vector<Int_t> binsx(blockSize), binsy(blockSize);
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *yblock = y + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, binsx.data(), stride);
+      fYaxis.FindFixBinN(n, yblock, binsy.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t binx = binsx[i];
+         const Int_t biny = binsy[i];
+         const Int_t bin = biny*(nbinsx+2) + binx;
+         const Double_t xx = xblock[i*stride];
+         const Double_t yy = yblock[i*stride];
+         const Double_t ww = wblock ? wblock[i*stride] : 1.;
+         if (sumw2) sumw2[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (!statOverflows && (binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy)) continue;
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*xx;
+         tsumwx2 += ww*xx*xx;
+         tsumwy  += ww*yy;
+         tsumwy2 += ww*yy*yy;
+         tsumwxy += ww*xx*yy;
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy;
+   fTsumwy2 = tsumwy2;
+   fTsumwxy = tsumwxy;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
@@ -1254,6 +1339,7 @@ void TH2::GetRandom2(Double_t &x, Double_t &y, TRandom * rng)
 void TH2::GetStats(Double_t *stats) const
 {
    if (fBuffer) ((TH2*)this)->BufferEmpty();
+   if (fConcurrentFill) fConcurrentFill->Fold();
 
    if ((fTsumw == 0 && fEntries > 0) || fXaxis.TestBit(TAxis::kAxisRange) || fYaxis.TestBit(TAxis::kAxisRange)) {
       std::fill(stats, stats + 7, 0);
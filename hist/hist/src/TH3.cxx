@@ -24,6 +24,9 @@
 #include "TError.h"
 #include "TMath.h"
 #include "TObjString.h"
+#include "TH1ConcurrentFill.h"
+
+#include <vector>
 
 ClassImp(TH3);
 
@@ -384,6 +387,7 @@ Int_t TH3::Fill(Double_t )
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 {
    if (fBuffer) return BufferFill(x,y,z,1);
+   if (fConcurrentFill) return TH3::Fill(x, y, z, 1.);
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -432,6 +436,16 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,z,w);
+   if (fConcurrentFill) {
+      const Int_t binx = fXaxis.FindFixBin(x);
+      const Int_t biny = fYaxis.FindFixBin(y);
+      const Int_t binz = fZaxis.FindFixBin(z);
+      const Bool_t inStats = (binx > 0 && binx <= fXaxis.GetNbins() && biny > 0 && biny <= fYaxis.GetNbins() &&
+                              binz > 0 && binz <= fZaxis.GetNbins()) ||
+                             GetStatOverflowsBehaviour();
+      return fConcurrentFill->Fill(binx + (fXaxis.GetNbins()+2)*(biny + (fYaxis.GetNbins()+2)*binz), inStats, w, x,
+                                   y, z);
+   }
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -812,6 +826,140 @@ Int_t TH3::Fill(Double_t x, Double_t y, const char *namez, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 3-D histogram with an array of values and weights.
+///
+///  - ntimes:  number of entries in arrays x, y, z and w (array size must be ntimes*stride)
+///  - x:       array of x values to be histogrammed
+///  - y:       array of y values to be histogrammed
+///  - z:       array of z values to be histogrammed
+///  - w:       array of weights
+///  - stride:  step size through arrays x, y, z and w
+///
+///   - If the weight is not equal to 1, the storage of the sum of squares of
+///     weights is automatically triggered and the sum of the squares of weights is incremented
+///     by w[i]^2 in the bin corresponding to x[i],y[i],z[i].
+///   - If w is NULL each entry is assumed a weight=1
+///
+/// NB: function only valid for a TH3x object
+
+void TH3::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t i;
+   if (fConcurrentFill) {
+      for (i = 0; i < ntimes; ++i)
+         TH3::Fill(x[i*stride], y[i*stride], z[i*stride], w ? w[i*stride] : 1.);
+      return;
+   }
+   ntimes *= stride;
+   Int_t ifirst = 0;
+
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         if (w) BufferFill(x[i],y[i],z[i],w[i]);
+         else BufferFill(x[i], y[i], z[i], 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer==nullptr)
+         ifirst = i;
+      else
+         return;
+   }
+
+   if ((!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) && (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric()) &&
+       (!fZaxis.CanExtend() || fZaxis.IsAlphanumeric())) {
+      // the axes cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes((ntimes-ifirst)/stride, &x[ifirst], &y[ifirst], &z[ifirst], w ? &w[ifirst] : nullptr, stride);
+      return;
+   }
+
+   for (i=ifirst;i<ntimes;i+=stride)
+      TH3::Fill(x[i], y[i], z[i], w ? w[i] : 1.);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill a 3-D histogram from arrays when the axes cannot be extended.
+///
+/// Gives the same result as TH3::Fill called for each entry, see TH1::DoFillNFixedAxes.
+
+void TH3::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                           Int_t stride)
+{
+   if (ntimes <= 0) return;
+   fEntries += ntimes;
+   if (!fSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   const Int_t blockSize = std::min(kBlockSize, ntimes);
+   std::vector<Int_t> binsx(blockSize), binsy(blockSize), binsz(blockSize);
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Int_t nbinsz = fZaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+   Double_t tsumwz = fTsumwz, tsumwz2 = fTsumwz2, tsumwxz = fTsumwxz, tsumwyz = fTsumwyz;
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *yblock = y + std::size_t(first) * stride;
+      const Double_t *zblock = z + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, binsx.data(), stride);
+      fYaxis.FindFixBinN(n, yblock, binsy.data(), stride);
+      fZaxis.FindFixBinN(n, zblock, binsz.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t binx = binsx[i];
+         const Int_t biny = binsy[i];
+         const Int_t binz = binsz[i];
+         const Int_t bin = binx + (nbinsx+2)*(biny + (nbinsy+2)*binz);
+         const Double_t xx = xblock[i*stride];
+         const Double_t yy = yblock[i*stride];
+         const Double_t zz = zblock[i*stride];
+         const Double_t ww = wblock ? wblock[i*stride] : 1.;
+         if (sumw2) sumw2[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (!statOverflows && (binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy || binz == 0 || binz > nbinsz))
+            continue;
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*xx;
+         tsumwx2 += ww*xx*xx;
+         tsumwy  += ww*yy;
+         tsumwy2 += ww*yy*yy;
+         tsumwxy += ww*xx*yy;
+         tsumwz  += ww*zz;
+         tsumwz2 += ww*zz*zz;
+         tsumwxz += ww*xx*zz;
+         tsumwyz += ww*yy*zz;
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy;
+   fTsumwy2 = tsumwy2;
+   fTsumwxy = tsumwxy;
+   fTsumwz = tsumwz;
+   fTsumwz2 = tsumwz2;
+   fTsumwxz = tsumwxz;
+   fTsumwyz = tsumwyz;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
 ///
@@ -1310,6 +1458,7 @@ void TH3::GetRandom3(Double_t &x, Double_t &y, Double_t &z, TRandom * rng)
 void TH3::GetStats(Double_t *stats) const
 {
    if (fBuffer) ((TH3*)this)->BufferEmpty();
+   if (fConcurrentFill) fConcurrentFill->Fold();
 
    Int_t bin, binx, biny, binz;
    Double_t w,err;
@@ -33,6 +33,9 @@
 #include "Math/MinimizerOptions.h"
 #include "Math/WrappedMultiTF1.h"
 
+#include <algorithm>
+#include <vector>
+
 
 /** \class THnBase
     \ingroup Hist
@@ -482,6 +485,47 @@ void THnBase::Add(const TH1* hist, Double_t c /*=1.*/)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with nentries entries.
+///
+/// \param[in] nentries number of entries
+/// \param[in] x coordinates of the entries: the coordinate of entry i along
+///             axis d is x[i * GetNdimensions() + d]
+/// \param[in] w weights of the entries; if null, all entries have weight 1
+///
+/// Equivalent to calling Fill() for each entry, but the bins along each axis
+/// are looked up for a block of entries at once, see TAxis::FindFixBinN.
+
+void THnBase::FillN(Int_t nentries, const Double_t *x, const Double_t *w /*= nullptr*/)
+{
+   for (Int_t d = 0; d < fNdimensions; ++d) {
+      const TAxis *axis = GetAxis(d);
+      if (axis->CanExtend() && axis->GetParent()) {
+         // FindBin() might extend the axis, fill entry by entry
+         for (Int_t i = 0; i < nentries; ++i)
+            Fill(x + (Long64_t)i * fNdimensions, w ? w[i] : 1.);
+         return;
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   std::vector<Int_t> bins(kBlockSize * fNdimensions); // bins[d * kBlockSize + i]: bin of entry i along axis d
+   std::vector<Int_t> coord(fNdimensions);
+   for (Int_t first = 0; first < nentries; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, nentries - first);
+      const Double_t *xblock = x + (Long64_t)first * fNdimensions;
+      for (Int_t d = 0; d < fNdimensions; ++d)
+         GetAxis(d)->FindFixBinN(n, xblock + d, &bins[d * kBlockSize], fNdimensions);
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t wi = w ? w[first + i] : 1.;
+         for (Int_t d = 0; d < fNdimensions; ++d)
+            coord[d] = bins[d * kBlockSize + i];
+         UpdateXStat(xblock + (Long64_t)i * fNdimensions, wi);
+         FillBin(GetBin(coord.data(), kTRUE /*alloc*/), wi);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///   Fit a THnSparse with function f
 ///
@@ -16,6 +16,8 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -270,9 +272,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin hash table.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the hash table's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -318,9 +320,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin hash table.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the hash table's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -409,6 +411,96 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinHashTable
+THnSparseBinHashTable is used internally by THnSparse to find the linear
+index of a filled bin given the hash of its compact coordinates.
+It is an open addressing hash table with linear probing: the hash and
+the index of each bin are stored next to each other in one flat array,
+so that a lookup usually touches a single cache line. Bins with the same
+hash (only possible if the compact coordinates take more than 8 bytes)
+simply occupy further slots of the probe sequence.
+*/
+
+class THnSparseBinHashTable {
+public:
+   struct Slot {
+      ULong64_t fHash = 0;
+      Long64_t fIndex = -1; // linear bin index, -1 for empty slots
+   };
+
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fSlots.size(); }
+
+   void Clear() {
+      fSlots.clear();
+      fSize = 0;
+   }
+
+   /// Make room for nbins bins without rehashing.
+   void Reserve(Long64_t nbins) {
+      if (2 * nbins > GetCapacity())
+         Rehash(2 * nbins);
+   }
+
+   /// Return the index of the bin with the given hash for which
+   /// matches(index) returns true, or -1 if there is no such bin.
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const {
+      if (fSlots.empty())
+         return -1;
+      const ULong64_t mask = fSlots.size() - 1;
+      for (ULong64_t pos = FirstSlot(hash); ; pos = (pos + 1) & mask) {
+         const Slot &slot = fSlots[pos];
+         if (slot.fIndex < 0)
+            return -1;
+         if (slot.fHash == hash && matches(slot.fIndex))
+            return slot.fIndex;
+      }
+   }
+
+   /// Add a bin; it must not be in the table yet.
+   void Insert(ULong64_t hash, Long64_t index) {
+      // keep the load factor below 1/2: probe sequences stay short and always end
+      if (2 * (fSize + 1) > GetCapacity())
+         Rehash(2 * GetCapacity());
+      Place(hash, index);
+      ++fSize;
+   }
+
+private:
+   std::vector<Slot> fSlots; // the number of slots is a power of 2
+   Int_t fShift = 0;         // 64 - log2(number of slots)
+   Long64_t fSize = 0;       // number of bins in the table
+
+   /// Fibonacci hashing: the compact coordinates used as hash have their
+   /// entropy in the low bits, the multiplication spreads it to the high ones.
+   ULong64_t FirstSlot(ULong64_t hash) const {
+      return (hash * 0x9E3779B97F4A7C15ull) >> fShift;
+   }
+
+   void Place(ULong64_t hash, Long64_t index) {
+      const ULong64_t mask = fSlots.size() - 1;
+      ULong64_t pos = FirstSlot(hash);
+      while (fSlots[pos].fIndex >= 0)
+         pos = (pos + 1) & mask;
+      fSlots[pos].fHash = hash;
+      fSlots[pos].fIndex = index;
+   }
+
+   void Rehash(Long64_t minCapacity) {
+      Int_t log2 = 4;
+      while ((1ll << log2) < minCapacity)
+         ++log2;
+      std::vector<Slot> old(1ull << log2);
+      fSlots.swap(old);
+      fShift = 64 - log2;
+      for (const Slot &slot : old)
+         if (slot.fIndex >= 0)
+            Place(slot.fHash, slot.fIndex);
+   }
+};
+
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -570,14 +662,14 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open addressing hash
+table fBinHashTable; the coordinates of the entry it points to are compared
+to the coordinates passed to GetBin(). If they do not match, these two
+coordinates have the same hash - which is extremely unlikely but (for the
+case where the compact bin coordinates are larger than 8 bytes) possible.
+In this case the lookup continues along the probe sequence of the hash table,
+comparing each bin with the same hash to the coordinates passed to GetBin(),
+until the matching bin or an empty slot is found.
 */
 
 
@@ -587,7 +679,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(1024), fFilledBins(0), fBinHashTable(new THnSparseBinHashTable), fCompactCoord(nullptr)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +696,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(chunksize), fFilledBins(0), fBinHashTable(new THnSparseBinHashTable), fCompactCoord(nullptr)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -614,6 +706,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinHashTable;
    delete fCompactCoord;
 }
 
@@ -650,36 +743,22 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///We have been streamed; set up fBinHashTable
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinHashTable()
 {
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = nullptr;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBinHashTable->Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinHashTable->Insert(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -687,12 +766,10 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
+   if (!fBinHashTable->GetSize() && fBinContent.GetSize()) {
+      FillBinHashTable();
    }
+   fBinHashTable->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -790,21 +867,12 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+   if (fBinContent.GetSize() && !fBinHashTable->GetSize())
+      FillBinHashTable();
+   const Long64_t linidx = fBinHashTable->Find(hash, [this, cc](Long64_t idx) {
+      return GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, cc->GetBuffer());
+   });
+   if (linidx >= 0 || !allocate) return linidx;
 
    ++fFilledBins;
 
@@ -819,16 +887,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinHashTable->Insert(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +939,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += sizeof(THnSparseBinHashTable::Slot) * fBinHashTable->GetCapacity();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1021,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBinHashTable->Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
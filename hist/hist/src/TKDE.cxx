@@ -22,6 +22,12 @@
 
  The algorithm is briefly described in (4). A binned version is also implemented to address the
  performance issue due to its data size dependance.
+
+ For large data samples the density can also be computed once on a fine grid, see
+ TKDE::SetEvaluation(TKDE::kGridEvaluation): the data are linearly binned on the grid and convolved with the
+ kernel using FFTs, and each evaluation is then a linear interpolation on the grid. The grid spacing (and, for the
+ adaptive iteration, the bandwidth resolution) are chosen to reach the accuracy set by TKDE::SetGridTolerance().
+ TKDE::GetValues() evaluates the density at many points at once, in parallel if implicit multi-threading is enabled.
  */
 
 
@@ -31,6 +37,7 @@
 #include <numeric>
 #include <limits>
 #include <cassert>
+#include <complex>
 
 #include "Math/Error.h"
 #include "TMath.h"
@@ -42,8 +49,14 @@
 #include "TF1.h"
 #include "TH1.h"
 #include "TVirtualPad.h"
+#include "TROOT.h"
 #include "TKDE.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 ClassImp(TKDE);
 
 
@@ -70,8 +83,10 @@ TKDE::TKDE() :
    fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
    fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
-   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
+   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0),
+   fGridTolerance(1.E-3), fGridStep(0.)
 {
+   fEvaluation = kExactEvaluation;
 }
 
 TKDE::~TKDE() {
@@ -111,9 +126,11 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fAdaptiveBandwidthFactor = 1.;
    fRho = rho;
    fWeightSize = 0;
+   fGridTolerance = 1.E-3;
+   fGridStep = 0.;
    fCanonicalBandwidths = std::vector<Double_t>(kTotalKernels, 0.0);
    fKernelSigmas2 = std::vector<Double_t>(kTotalKernels, -1.0);
-   fSettedOptions = std::vector<Bool_t>(4, kFALSE);
+   fSettedOptions = std::vector<Bool_t>(5, kFALSE);
    SetOptions(option, rho);
    CheckOptions(kTRUE);
    SetMirror();
@@ -128,7 +145,7 @@ void TKDE::SetOptions(const Option_t* option, Double_t rho) {
    TString opt = option;
    opt.ToLower();
    std::string options = opt.Data();
-   size_t numOpt = 4;
+   size_t numOpt = 5;
    std::vector<std::string> voption(numOpt, "");
    for (std::vector<std::string>::iterator it = voption.begin(); it != voption.end() && !options.empty(); ++it) {
       size_t pos = options.find_last_of(';');
@@ -264,6 +281,17 @@ void TKDE::GetOptions(std::string optionType, std::string option) {
          this->Info("GetOptions", "Possible binning type options are: Unbinned, ForcedBinning, RelaxedBinning");
          fBinning = kRelaxedBinning;
       }
+   } else if (optionType.compare("evaluation") == 0) {
+      fSettedOptions[4] = kTRUE;
+      if (option.compare("exact") == 0) {
+         fEvaluation = kExactEvaluation;
+      } else if (option.compare("grid") == 0) {
+         fEvaluation = kGridEvaluation;
+      } else {
+         this->Warning("GetOptions", "Unknown evaluation option %s: setting to Exact", option.c_str());
+         this->Info("GetOptions", "Possible evaluation type options are: Exact, Grid");
+         fEvaluation = kExactEvaluation;
+      }
    }
 }
 
@@ -281,6 +309,9 @@ void TKDE::AssureOptions() {
    if (!fSettedOptions[3]) {
       fBinning = kRelaxedBinning;
    }
+   if (!fSettedOptions[4]) {
+      fEvaluation = kExactEvaluation;
+   }
 }
 
 void TKDE::CheckOptions(Bool_t isUserDefinedKernel) {
@@ -300,6 +331,10 @@ void TKDE::CheckOptions(Bool_t isUserDefinedKernel) {
       Warning("CheckOptions", "Illegal user binning type input - use default value !");
       fBinning = kRelaxedBinning;
    }
+   if (fEvaluation != kExactEvaluation && fEvaluation != kGridEvaluation) {
+      Warning("CheckOptions", "Illegal user evaluation type input - use default value !");
+      fEvaluation = kExactEvaluation;
+   }
    if (fRho <= 0.0) {
       Warning("CheckOptions", "Tuning factor rho cannot be non-positive - use default value !");
       fRho = 1.0;
@@ -389,6 +424,27 @@ void TKDE::SetRange(Double_t xMin, Double_t xMax) {
    fKernel.reset();
 }
 
+void TKDE::SetEvaluation(EEvaluation eval) {
+   // Sets User option for evaluating the density exactly or by interpolation on a grid
+   fEvaluation = eval;
+   CheckOptions();
+   if (fEvaluation == kGridEvaluation && fKernelType == kUserDefined)
+      Warning("SetEvaluation", "Grid evaluation needs a kernel with known support - user defined kernels use exact evaluation");
+   fKernel.reset();
+}
+
+void TKDE::SetGridTolerance(Double_t tolerance) {
+   // Sets the accuracy targeted by the grid evaluation, relative to the maximum of the density.
+   // Smaller values make the grid finer, for the adaptive iteration also the bandwidths
+   if (tolerance <= 0. || tolerance >= 1.) {
+      Error("SetGridTolerance", "Tolerance must be in (0,1). Present value %g remains the same.", fGridTolerance);
+      return;
+   }
+   fGridTolerance = tolerance;
+   if (fEvaluation == kGridEvaluation)
+      fKernel.reset();
+}
+
 // private methods
 
 void TKDE::SetUseBins() {
@@ -604,9 +660,20 @@ void TKDE::SetKernel() {
    weight *= fRho * fCanonicalBandwidths[fKernelType] / fCanonicalBandwidths[kGaussian];
 
    fKernel = std::make_unique<TKernel>(weight, this);
+   fGrid.clear();
 
    if (fIteration == kAdaptive) {
-      fKernel->ComputeAdaptiveWeights();
+      // with grid evaluation also the fixed-bandwidth (pilot) density at the data points, on which the adaptive
+      // bandwidths depend, comes from a grid: a single convolution, kept only until the adaptive weights are set
+      std::vector<Double_t> pilotGrid;
+      Double_t pilotStep = 0.;
+      if (fEvaluation == kGridEvaluation) {
+         ComputeGrid(pilotGrid, pilotStep);
+      }
+      fKernel->ComputeAdaptiveWeights(pilotGrid, pilotStep);
+   }
+   if (fEvaluation == kGridEvaluation) {
+      ComputeGrid(fGrid, fGridStep);
    }
    if (gDebug) {
       if (fIteration != kAdaptive)
@@ -745,9 +812,43 @@ Double_t TKDE::operator()(Double_t x) const {
       // in case of failed re-initialization
       if (!fKernel) return TMath::QuietNaN();
    }
+   if (!fGrid.empty() && x >= fXMin && x <= fXMax) {
+      return InterpolateGrid(fGrid, fGridStep, x);
+   }
    return (*fKernel)(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the density at n points x, storing the results in values.
+/// The points are processed in parallel if implicit multi-threading is enabled.
+void TKDE::GetValues(UInt_t n, const Double_t *x, Double_t *values) const {
+   if (n == 0) return;
+   // initialize before going parallel
+   if (!fKernel) {
+      (const_cast<TKDE*>(this))->ReInit();
+      if (!fKernel) {
+         std::fill(values, values + n, TMath::QuietNaN());
+         return;
+      }
+   }
+   auto evaluate = [&](UInt_t begin, UInt_t end) {
+      for (UInt_t i = begin; i < end; ++i)
+         values[i] = (*this)(x[i]);
+   };
+#ifdef R__USE_IMT
+   // the exact evaluation costs one kernel per data point, the grid one is a few operations
+   const Double_t cost = Double_t(n) * (fGrid.empty() ? fData.size() : 1);
+   if (ROOT::IsImplicitMTEnabled() && cost > 1.E6) {
+      ROOT::TThreadExecutor &pool = const_cast<TKDE *>(this)->GetExecutor();
+      const UInt_t nChunks = std::min(n, 4 * pool.GetPoolSize());
+      pool.Foreach([&](UInt_t chunk) { evaluate(UInt_t(ULong64_t(n) * chunk / nChunks), UInt_t(ULong64_t(n) * (chunk + 1) / nChunks)); },
+                   ROOT::TSeq<UInt_t>(0, nChunks));
+      return;
+   }
+#endif
+   evaluate(0, n);
+}
+
 Double_t TKDE::GetMean() const {
    // return the mean of the data
    if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
@@ -773,8 +874,9 @@ fNWeights(kde->fData.size()),
 fWeights(1, weight)
 {}
 
-void TKDE::TKernel::ComputeAdaptiveWeights() {
+void TKDE::TKernel::ComputeAdaptiveWeights(const std::vector<Double_t> &pilotGrid, Double_t pilotStep) {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
+   // The fixed-bandwidth density is interpolated on pilotGrid, if given, inside [fXMin, fXMax]
    unsigned int n = fKDE->fData.size();
    Double_t minWeight = fWeights[0] * 0.05;
    // we will store computed adaptive weights in weights
@@ -787,7 +889,9 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      const Double_t x = fKDE->fData[i];
+      f = (!pilotGrid.empty() && x >= fKDE->fXMin && x <= fKDE->fXMax) ? fKDE->InterpolateGrid(pilotGrid, pilotStep, x)
+                                                                         : (*fKDE)(x);
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -1045,6 +1149,206 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    return result / nSum;
 }
 
+namespace {
+
+/// In-place radix-2 FFT of a, whose size must be a power of two. The inverse transform is not normalized.
+void FFT(std::vector<std::complex<Double_t>> &a, bool inverse)
+{
+   const size_t n = a.size();
+   for (size_t i = 1, j = 0; i < n; ++i) {
+      size_t bit = n >> 1;
+      for (; j & bit; bit >>= 1)
+         j ^= bit;
+      j ^= bit;
+      if (i < j)
+         std::swap(a[i], a[j]);
+   }
+   // twiddle factors for the largest butterfly, the smaller ones use every (n / len)-th
+   std::vector<std::complex<Double_t>> twiddles(n / 2);
+   for (size_t k = 0; k < n / 2; ++k)
+      twiddles[k] = std::polar(1., (inverse ? 2. : -2.) * M_PI * k / n);
+   for (size_t len = 2; len <= n; len <<= 1) {
+      const size_t stride = n / len;
+      for (size_t i = 0; i < n; i += len) {
+         for (size_t k = 0; k < len / 2; ++k) {
+            const std::complex<Double_t> u = a[i + k];
+            const std::complex<Double_t> v = a[i + k + len / 2] * twiddles[k * stride];
+            a[i + k] = u + v;
+            a[i + k + len / 2] = u - v;
+         }
+      }
+   }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the density on the grid used by kGridEvaluation.
+/// The data points (or bins) are linearly binned on a grid that extends beyond [fXMin, fXMax] by the kernel
+/// support, and convolved with the sampled kernel by FFT. For adaptive bandwidths the points are split between the
+/// two nearest bandwidths of a geometric sequence, linearly in log(bandwidth); the convolutions for each bandwidth
+/// are summed in frequency space, in parallel if implicit multi-threading is enabled.
+/// If the grid cannot be built (user defined kernel, no data or too large grid) grid stays empty, which means
+/// exact evaluation.
+void TKDE::ComputeGrid(std::vector<Double_t> &grid, Double_t &gridStep) {
+   grid.clear();
+   // kernels are exactly zero beyond their support; it is unknown for user defined kernels
+   const Double_t support = (fKernelType == kGaussian) ? 9. : (fKernelType == kUserDefined) ? 0. : 1.;
+   const UInt_t n = fData.size();
+   if (support == 0. || !fKernel || n == 0 || !(fXMax > fXMin) || fSumOfCounts == 0) return;
+
+   const std::vector<Double_t> &weights = fKernel->GetAdaptiveWeights();
+   const Bool_t hasAdaptiveWeights = (weights.size() == n);
+   const Bool_t useCount = (fBinCount.size() == n);
+   Double_t hMin = weights[0];
+   Double_t hMax = weights[0];
+   if (hasAdaptiveWeights) {
+      hMin = std::numeric_limits<Double_t>::max();
+      hMax = 0;
+      for (auto h : weights) {
+         // points with a zero bandwidth are skipped, as in the exact evaluation
+         if (h > 0) {
+            hMin = std::min(hMin, h);
+            hMax = std::max(hMax, h);
+         }
+      }
+   }
+   if (!(hMax > 0)) return;
+
+   // The linear binning and the linear interpolation each bias the density by about (step / h)^2 / 8 of its
+   // maximum; the split between two bandwidths by about (log-bandwidth step)^2 / 8.
+   const UInt_t kMaxGridSize = 1u << 22;
+   const Double_t gridSize = (fXMax - fXMin) / (hMin * std::sqrt(2. * fGridTolerance)) + 2;
+   if (gridSize > kMaxGridSize) {
+      Warning("ComputeGrid", "Limiting the grid to %u points, the requested tolerance %g will not be reached", kMaxGridSize, fGridTolerance);
+   }
+   const UInt_t nGrid = UInt_t(std::min(gridSize, Double_t(kMaxGridSize)));
+   const Double_t step = (fXMax - fXMin) / (nGrid - 1);
+   const Double_t margin = std::ceil(support * hMax / step) + 1;
+   if (nGrid + 3 * margin > 4. * kMaxGridSize) {
+      Warning("ComputeGrid", "Too many grid points needed for the bandwidths in [%g, %g] - use exact evaluation", hMin, hMax);
+      return;
+   }
+   const UInt_t nMargin = UInt_t(margin);
+   const UInt_t nSource = nGrid + 2 * nMargin;
+   const Double_t sourceMin = fXMin - nMargin * step;
+   // the FFT is long enough that the circular convolution does not wrap around into the output grid
+   UInt_t nFFT = 1;
+   while (nFFT < nSource + nMargin)
+      nFFT <<= 1;
+
+   // Sort the points by bandwidth: point i contributes (1 - frac) to bandwidth class floor(u_i) and frac to the next
+   const Double_t logStep = 2. * std::sqrt(fGridTolerance);
+   UInt_t nClasses = 1;
+   std::vector<Double_t> u;
+   std::vector<UInt_t> order;
+   std::vector<UInt_t> classStart(2, 0);
+   classStart[1] = n;
+   if (hasAdaptiveWeights) {
+      nClasses = UInt_t(std::log(hMax / hMin) / logStep) + 2;
+      u.assign(n, 0.);
+      classStart.assign(nClasses + 1, 0);
+      for (UInt_t i = 0; i < n; ++i) {
+         if (weights[i] > 0) {
+            u[i] = std::log(weights[i] / hMin) / logStep;
+            ++classStart[UInt_t(u[i]) + 1];
+         }
+      }
+      std::partial_sum(classStart.begin(), classStart.end(), classStart.begin());
+      order.resize(classStart.back());
+      std::vector<UInt_t> next(classStart.begin(), classStart.end() - 1);
+      for (UInt_t i = 0; i < n; ++i) {
+         if (weights[i] > 0) order[next[UInt_t(u[i])]++] = i;
+      }
+   }
+
+   using Spectrum_t = std::vector<std::complex<Double_t>>;
+   auto addClass = [&](UInt_t c, Spectrum_t &sum) {
+      Spectrum_t source(nFFT);
+      auto addPoint = [&](Double_t x, Double_t w) {
+         const Double_t t = (x - sourceMin) / step;
+         if (!(t >= 0 && t < nSource - 1)) return;
+         const UInt_t j = UInt_t(t);
+         source[j] += w * (j + 1 - t);
+         source[j + 1] += w * (t - j);
+      };
+      auto addPoints = [&](UInt_t cls, Bool_t upper) {
+         for (UInt_t k = classStart[cls]; k < classStart[cls + 1]; ++k) {
+            const UInt_t i = hasAdaptiveWeights ? order[k] : k;
+            Double_t w = useCount ? fBinCount[i] : 1.0;
+            if (hasAdaptiveWeights) {
+               const Double_t frac = u[i] - cls;
+               w *= upper ? frac : 1. - frac;
+            }
+            addPoint(fData[i], w);
+            if (fAsymLeft) addPoint(2. * fXMin - fData[i], w);
+            if (fAsymRight) addPoint(2. * fXMax - fData[i], w);
+         }
+      };
+      addPoints(c, kFALSE);
+      if (c > 0) addPoints(c - 1, kTRUE);
+
+      const Double_t h = hasAdaptiveWeights ? hMin * std::exp(c * logStep) : hMin;
+      const Int_t m = std::min<Int_t>(nMargin, Int_t(std::ceil(support * h / step)));
+      Spectrum_t kernel(nFFT);
+      for (Int_t k = -m; k <= m; ++k)
+         kernel[(k + nFFT) % nFFT] = (*fKernelFunction)(k * step / h) / h;
+
+      FFT(source, false);
+      FFT(kernel, false);
+      if (sum.empty()) sum.assign(nFFT, 0.);
+      for (UInt_t k = 0; k < nFFT; ++k)
+         sum[k] += source[k] * kernel[k];
+   };
+
+   Spectrum_t spectrum;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nClasses > 1) {
+      ROOT::TThreadExecutor &pool = GetExecutor();
+      const UInt_t nChunks = std::min(nClasses, pool.GetPoolSize());
+      std::vector<Spectrum_t> partialSums(nChunks);
+      pool.Foreach([&](UInt_t chunk) {
+                      for (UInt_t c = chunk; c < nClasses; c += nChunks)
+                         addClass(c, partialSums[chunk]);
+                   },
+                   ROOT::TSeq<UInt_t>(0, nChunks));
+      spectrum = std::move(partialSums[0]);
+      for (UInt_t chunk = 1; chunk < nChunks; ++chunk)
+         for (UInt_t k = 0; k < nFFT; ++k)
+            spectrum[k] += partialSums[chunk][k];
+   } else
+#endif
+   {
+      for (UInt_t c = 0; c < nClasses; ++c)
+         addClass(c, spectrum);
+   }
+
+   FFT(spectrum, true);
+   grid.resize(nGrid);
+   gridStep = step;
+   const Double_t norm = 1. / (Double_t(nFFT) * fSumOfCounts);
+   for (UInt_t g = 0; g < nGrid; ++g)
+      grid[g] = spectrum[g + nMargin].real() * norm;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Linear interpolation of the density on a grid computed by ComputeGrid(), for x in [fXMin, fXMax].
+Double_t TKDE::InterpolateGrid(const std::vector<Double_t> &grid, Double_t step, Double_t x) const {
+   const Double_t t = (x - fXMin) / step;
+   const UInt_t i = std::min(UInt_t(t), UInt_t(grid.size() - 2));
+   return grid[i] + (t - i) * (grid[i + 1] - grid[i]);
+}
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// The thread pool used for the parallel evaluations, created once and reused by all of them.
+ROOT::TThreadExecutor &TKDE::GetExecutor() {
+   if (!fExecutor)
+      fExecutor = std::make_shared<ROOT::TThreadExecutor>();
+   return *fExecutor;
+}
+#endif
+
 ////////////////////////////////////////////////////
 /// compute the bin index given a data point x
 UInt_t TKDE::Index(Double_t x) const {
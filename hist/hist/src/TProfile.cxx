@@ -18,6 +18,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "TObjString.h"
+#include "Math/Util.h"
 
 #include "TProfileHelper.h"
 
@@ -771,7 +772,19 @@ Int_t TProfile::Fill(const char *namex, Double_t y, Double_t w)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Fill a Profile histogram with weights.
+/// Fill a Profile histogram with an array of values and weights.
+///
+/// \param[in] ntimes number of entries in arrays x, y and w (array sizes must be ntimes*stride)
+/// \param[in] x array of x values to be filled
+/// \param[in] y array of y values to be filled
+/// \param[in] w array of weights, or nullptr for unit weights
+/// \param[in] stride step size through arrays x, y and w
+///
+/// When the axis cannot be extended, the bins of all entries are looked up at once
+/// and the statistics of the entries are accumulated with compensated summation,
+/// see TProfile::DoFillNFixedAxes. This is faster and, for large arrays, more precise
+/// than calling TProfile::Fill for each entry. The compensation only covers the entries
+/// of one call: filling many small arrays is not more precise than filling each entry.
 
 void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
@@ -793,6 +806,12 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
+   if (!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) {
+      // the axis cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes((ntimes-ifirst)/stride, &x[ifirst], &y[ifirst], w ? &w[ifirst] : nullptr, stride);
+      return;
+   }
+
    for (i=ifirst;i<ntimes;i+=stride) {
       if (fYmin != fYmax) {
          if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
@@ -818,6 +837,75 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill a Profile histogram from arrays when the axis cannot be extended.
+///
+/// Gives the same result as TProfile::Fill called for each entry, up to rounding: the bins
+/// are found by TAxis::FindFixBinN for blocks of entries, and the statistics are summed
+/// with Kahan summation, starting from the current totals of the histogram. The sums of
+/// squares thus keep their precision when many entries are filled in large batches.
+/// The compensation terms are not kept between calls, and the bin contents are summed
+/// without compensation.
+
+void TProfile::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
+{
+   if (ntimes <= 0) return;
+   const Bool_t checkRange = fYmin != fYmax;
+   auto outOfRange = [&](Double_t yy) { return checkRange && (yy < fYmin || yy > fYmax || TMath::IsNaN(yy)); };
+   // Sumw2 must be called before the first weight different from 1 is added, see TH1::DoFillNFixedAxes
+   if (!fBinSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0 && !outOfRange(y[i*stride])) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   std::vector<Int_t> bins(std::min(kBlockSize, ntimes));
+
+   const Int_t nbins = fXaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *binSumw2 = fBinSumw2.fN ? fBinSumw2.fArray : nullptr;
+   Long64_t nentries = 0;
+   ROOT::Math::KahanSum<Double_t> tsumw(fTsumw), tsumw2(fTsumw2), tsumwx(fTsumwx), tsumwx2(fTsumwx2);
+   ROOT::Math::KahanSum<Double_t> tsumwy(fTsumwy), tsumwy2(fTsumwy2);
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *yblock = y + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, bins.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t yy = yblock[i*stride];
+         if (outOfRange(yy)) continue;
+         ++nentries;
+         const Int_t bin = bins[i];
+         const Double_t xx = xblock[i*stride];
+         const Double_t u = wblock ? wblock[i*stride] : 1.;
+         fArray[bin] += u*yy;
+         fSumw2.fArray[bin] += u*yy*yy;
+         if (binSumw2) binSumw2[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (!statOverflows && (bin == 0 || bin > nbins)) continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*xx;
+         tsumwx2 += u*xx*xx;
+         tsumwy  += u*yy;
+         tsumwy2 += u*yy*yy;
+      }
+   }
+   fEntries += nentries;
+   fTsumw   = tsumw.Sum();
+   fTsumw2  = tsumw2.Sum();
+   fTsumwx  = tsumwx.Sum();
+   fTsumwx2 = tsumwx2.Sum();
+   fTsumwy  = tsumwy.Sum();
+   fTsumwy2 = tsumwy2.Sum();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return bin content of a Profile histogram.
 
@@ -16,6 +16,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "TProfileHelper.h"
+#include "Math/Util.h"
 #include <iostream>
 
 Bool_t TProfile2D::fgApproximate = kFALSE;
@@ -685,6 +686,126 @@ Int_t TProfile2D::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    fTsumwz2 += u * z * z;
    return bin;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile2D histogram with arrays of values and weights.
+///
+/// \param[in] ntimes number of entries in arrays x, y, z and w (array sizes must be ntimes*stride)
+/// \param[in] x array of x values to be filled
+/// \param[in] y array of y values to be filled
+/// \param[in] z array of z values to be filled
+/// \param[in] w array of weights, or nullptr for unit weights
+/// \param[in] stride step size through arrays x, y, z and w
+///
+/// Gives the same result as TProfile2D::Fill(x, y, z, w) called for each entry, see TProfile::FillN.
+
+void TProfile2D::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                       Int_t stride)
+{
+   Int_t i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         BufferFill(x[i], y[i], z[i], w ? w[i] : 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer==nullptr)
+         ifirst = i;
+      else
+         return;
+   }
+
+   if ((!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) && (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric())) {
+      // the axes cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes((ntimes-ifirst)/stride, &x[ifirst], &y[ifirst], &z[ifirst], w ? &w[ifirst] : nullptr, stride);
+      return;
+   }
+
+   for (i=ifirst;i<ntimes;i+=stride)
+      Fill(x[i], y[i], z[i], w ? w[i] : 1.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill a Profile2D histogram from arrays when the axes cannot be extended.
+///
+/// Gives the same result as TProfile2D::Fill called for each entry, up to rounding,
+/// see TProfile::DoFillNFixedAxes.
+
+void TProfile2D::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z,
+                                  const Double_t *w, Int_t stride)
+{
+   if (ntimes <= 0) return;
+   const Bool_t checkRange = fZmin != fZmax;
+   auto outOfRange = [&](Double_t zz) { return checkRange && (zz < fZmin || zz > fZmax || TMath::IsNaN(zz)); };
+   if (!fBinSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0 && !outOfRange(z[i*stride])) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   const Int_t blockSize = std::min(kBlockSize, ntimes);
+   std::vector<Int_t> binsx(blockSize), binsy(blockSize);
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *binSumw2 = fBinSumw2.fN ? fBinSumw2.fArray : nullptr;
+   Long64_t nentries = 0;
+   ROOT::Math::KahanSum<Double_t> tsumw(fTsumw), tsumw2(fTsumw2), tsumwx(fTsumwx), tsumwx2(fTsumwx2);
+   ROOT::Math::KahanSum<Double_t> tsumwy(fTsumwy), tsumwy2(fTsumwy2), tsumwxy(fTsumwxy);
+   ROOT::Math::KahanSum<Double_t> tsumwz(fTsumwz), tsumwz2(fTsumwz2);
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *yblock = y + std::size_t(first) * stride;
+      const Double_t *zblock = z + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, binsx.data(), stride);
+      fYaxis.FindFixBinN(n, yblock, binsy.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t zz = zblock[i*stride];
+         if (outOfRange(zz)) continue;
+         ++nentries;
+         const Int_t binx = binsx[i];
+         const Int_t biny = binsy[i];
+         const Int_t bin = biny*(nbinsx+2) + binx;
+         const Double_t xx = xblock[i*stride];
+         const Double_t yy = yblock[i*stride];
+         const Double_t u = wblock ? wblock[i*stride] : 1.;
+         fArray[bin] += u*zz;
+         fSumw2.fArray[bin] += u*zz*zz;
+         if (binSumw2) binSumw2[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (!statOverflows && (binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy)) continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*xx;
+         tsumwx2 += u*xx*xx;
+         tsumwy  += u*yy;
+         tsumwy2 += u*yy*yy;
+         tsumwxy += u*xx*yy;
+         tsumwz  += u*zz;
+         tsumwz2 += u*zz*zz;
+      }
+   }
+   fEntries += nentries;
+   fTsumw   = tsumw.Sum();
+   fTsumw2  = tsumw2.Sum();
+   fTsumwx  = tsumwx.Sum();
+   fTsumwx2 = tsumwx2.Sum();
+   fTsumwy  = tsumwy.Sum();
+   fTsumwy2 = tsumwy2.Sum();
+   fTsumwxy = tsumwxy.Sum();
+   fTsumwz  = tsumwz.Sum();
+   fTsumwz2 = tsumwz2.Sum();
+}
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile2D histogram (no weights).
 
@@ -19,6 +19,7 @@
 #include "TClass.h"
 
 #include "TProfileHelper.h"
+#include "Math/Util.h"
 
 Bool_t TProfile3D::fgApproximate = kFALSE;
 
@@ -685,6 +686,144 @@ Int_t TProfile3D::Fill(Double_t x, Double_t y, Double_t z, Double_t t, Double_t
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile3D histogram with arrays of values and weights.
+///
+/// \param[in] ntimes number of entries in arrays x, y, z, t and w (array sizes must be ntimes*stride)
+/// \param[in] x array of x values to be filled
+/// \param[in] y array of y values to be filled
+/// \param[in] z array of z values to be filled
+/// \param[in] t array of t values to be filled
+/// \param[in] w array of weights, or nullptr for unit weights
+/// \param[in] stride step size through arrays x, y, z, t and w
+///
+/// Gives the same result as TProfile3D::Fill(x, y, z, t, w) called for each entry, see TProfile::FillN.
+
+void TProfile3D::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *t,
+                       const Double_t *w, Int_t stride)
+{
+   Int_t i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         BufferFill(x[i], y[i], z[i], t[i], w ? w[i] : 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer==nullptr)
+         ifirst = i;
+      else
+         return;
+   }
+
+   if ((!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) && (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric()) &&
+       (!fZaxis.CanExtend() || fZaxis.IsAlphanumeric())) {
+      // the axes cannot change while filling: look up the bins of all values at once
+      DoFillNFixedAxes((ntimes-ifirst)/stride, &x[ifirst], &y[ifirst], &z[ifirst], &t[ifirst],
+                       w ? &w[ifirst] : nullptr, stride);
+      return;
+   }
+
+   for (i=ifirst;i<ntimes;i+=stride)
+      Fill(x[i], y[i], z[i], t[i], w ? w[i] : 1.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method to fill a Profile3D histogram from arrays when the axes cannot be extended.
+///
+/// Gives the same result as TProfile3D::Fill called for each entry, up to rounding,
+/// see TProfile::DoFillNFixedAxes.
+
+void TProfile3D::DoFillNFixedAxes(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z,
+                                  const Double_t *t, const Double_t *w, Int_t stride)
+{
+   if (ntimes <= 0) return;
+   const Bool_t checkRange = fTmin != fTmax;
+   auto outOfRange = [&](Double_t tt) { return checkRange && (tt < fTmin || tt > fTmax || TMath::IsNaN(tt)); };
+   if (!fBinSumw2.fN && w && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i*stride] != 1.0 && !outOfRange(t[i*stride])) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   constexpr Int_t kBlockSize = 1024;
+   const Int_t blockSize = std::min(kBlockSize, ntimes);
+   std::vector<Int_t> binsx(blockSize), binsy(blockSize), binsz(blockSize);
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Int_t nbinsz = fZaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *binSumw2 = fBinSumw2.fN ? fBinSumw2.fArray : nullptr;
+   Long64_t nentries = 0;
+   ROOT::Math::KahanSum<Double_t> tsumw(fTsumw), tsumw2(fTsumw2), tsumwx(fTsumwx), tsumwx2(fTsumwx2);
+   ROOT::Math::KahanSum<Double_t> tsumwy(fTsumwy), tsumwy2(fTsumwy2), tsumwxy(fTsumwxy);
+   ROOT::Math::KahanSum<Double_t> tsumwz(fTsumwz), tsumwz2(fTsumwz2), tsumwxz(fTsumwxz), tsumwyz(fTsumwyz);
+   ROOT::Math::KahanSum<Double_t> tsumwt(fTsumwt), tsumwt2(fTsumwt2);
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + std::size_t(first) * stride;
+      const Double_t *yblock = y + std::size_t(first) * stride;
+      const Double_t *zblock = z + std::size_t(first) * stride;
+      const Double_t *tblock = t + std::size_t(first) * stride;
+      const Double_t *wblock = w ? w + std::size_t(first) * stride : nullptr;
+      fXaxis.FindFixBinN(n, xblock, binsx.data(), stride);
+      fYaxis.FindFixBinN(n, yblock, binsy.data(), stride);
+      fZaxis.FindFixBinN(n, zblock, binsz.data(), stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t tt = tblock[i*stride];
+         if (outOfRange(tt)) continue;
+         ++nentries;
+         const Int_t binx = binsx[i];
+         const Int_t biny = binsy[i];
+         const Int_t binz = binsz[i];
+         const Int_t bin = binx + (nbinsx+2)*(biny + (nbinsy+2)*binz);
+         const Double_t xx = xblock[i*stride];
+         const Double_t yy = yblock[i*stride];
+         const Double_t zz = zblock[i*stride];
+         const Double_t u = wblock ? wblock[i*stride] : 1.;
+         fArray[bin] += u*tt;
+         fSumw2.fArray[bin] += u*tt*tt;
+         if (binSumw2) binSumw2[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (!statOverflows &&
+             (binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy || binz == 0 || binz > nbinsz)) continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*xx;
+         tsumwx2 += u*xx*xx;
+         tsumwy  += u*yy;
+         tsumwy2 += u*yy*yy;
+         tsumwxy += u*xx*yy;
+         tsumwz  += u*zz;
+         tsumwz2 += u*zz*zz;
+         tsumwxz += u*xx*zz;
+         tsumwyz += u*yy*zz;
+         tsumwt  += u*tt;
+         tsumwt2 += u*tt*tt;
+      }
+   }
+   fEntries += nentries;
+   fTsumw   = tsumw.Sum();
+   fTsumw2  = tsumw2.Sum();
+   fTsumwx  = tsumwx.Sum();
+   fTsumwx2 = tsumwx2.Sum();
+   fTsumwy  = tsumwy.Sum();
+   fTsumwy2 = tsumwy2.Sum();
+   fTsumwxy = tsumwxy.Sum();
+   fTsumwz  = tsumwz.Sum();
+   fTsumwz2 = tsumwz2.Sum();
+   fTsumwxz = tsumwxz.Sum();
+   fTsumwyz = tsumwyz.Sum();
+   fTsumwt  = tsumwt.Sum();
+   fTsumwt2 = tsumwt2.Sum();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return bin content of a Profile3D histogram.
 
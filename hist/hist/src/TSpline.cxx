@@ -85,6 +85,19 @@ TSpline& TSpline::operator=(const TSpline &sp)
    return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this spline at the n abscissas x and store the values in y.
+///
+/// Gives the same result as calling Eval for each value. TSpline3 and TSpline5
+/// reuse the interval of the previous value as a starting point for the search
+/// of the next one, which makes the evaluation of sorted or clustered abscissas faster.
+
+void TSpline::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   for (Int_t i = 0; i < n; ++i)
+      y[i] = Eval(x[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Draw this function with its current attributes.
 ///
@@ -780,6 +793,22 @@ Int_t TSpline3::FindX(Double_t x) const
    return klow;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find X, starting with the knot interval hint and the one following it.
+///
+/// Gives the same result as FindX(x), but avoids the binary search when x
+/// lies in the interval of the previously evaluated abscissa or in the next one,
+/// as is the case when evaluating the spline on sorted or clustered values.
+
+Int_t TSpline3::FindX(Double_t x, Int_t hint) const
+{
+   if (!fKstep && x > fXmin && x < fXmax && hint >= 0 && hint < fNp-1 && fPoly[hint].X() < x) {
+      if (x <= fPoly[hint+1].X()) return hint;
+      if (hint+2 < fNp && x <= fPoly[hint+2].X()) return hint+1;
+   }
+   return FindX(x);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Eval this spline at x.
 
@@ -790,6 +819,20 @@ Double_t TSpline3::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n abscissas x, see TSpline::EvalN.
+
+void TSpline3::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   Int_t klow = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      klow = FindX(x[i], klow);
+      if (klow >= fNp-1 && fNp > 1) klow = fNp-2;
+      // non-virtual call, so that the polynomial is inlined
+      y[i] = fPoly[klow].TSplinePoly3::Eval(x[i]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
@@ -1557,6 +1600,19 @@ Int_t TSpline5::FindX(Double_t x) const
    return klow;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find X, starting with the knot interval hint and the one following it,
+/// see TSpline3::FindX(Double_t, Int_t).
+
+Int_t TSpline5::FindX(Double_t x, Int_t hint) const
+{
+   if (!fKstep && x > fXmin && x < fXmax && hint >= 0 && hint < fNp-1 && fPoly[hint].X() < x) {
+      if (x <= fPoly[hint+1].X()) return hint;
+      if (hint+2 < fNp && x <= fPoly[hint+2].X()) return hint+1;
+   }
+   return FindX(x);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Eval this spline at x.
 
@@ -1566,6 +1622,18 @@ Double_t TSpline5::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n abscissas x, see TSpline::EvalN.
+
+void TSpline5::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   Int_t klow = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      klow = FindX(x[i], klow);
+      y[i] = fPoly[klow].TSplinePoly5::Eval(x[i]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
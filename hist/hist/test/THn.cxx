@@ -1,6 +1,10 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
+#include "TRandom3.h"
+
+#include <vector>
 #include "TH1.h"
 #include "TH2.h"
 
@@ -144,3 +148,55 @@ TEST(THn, GetBinCenter)
    EXPECT_DOUBLE_EQ(centers.at(0), 2.5);
    EXPECT_DOUBLE_EQ(centers.at(1), -1.5);
 }
+
+// Filling THnSparse entry by entry or in bulk gives the same bins, also when the compact bin coordinates do not
+// fit into 8 bytes and are hashed.
+TEST(THnSparse, FillN)
+{
+   constexpr Int_t dim = 10;
+   Int_t bins[dim];
+   Double_t xmin[dim];
+   Double_t xmax[dim];
+   for (Int_t d = 0; d < dim; ++d) {
+      bins[d] = 1000; // 10 bits per axis: 100 bits per bin coordinate
+      xmin[d] = -5.;
+      xmax[d] = 5.;
+   }
+   THnSparseD hFill("hFill", "", dim, bins, xmin, xmax, /*chunksize*/ 100);
+   THnSparseD hFillN("hFillN", "", dim, bins, xmin, xmax, /*chunksize*/ 100);
+   hFill.Sumw2();
+   hFillN.Sumw2();
+
+   TRandom3 rng(1);
+   constexpr Int_t n = 5000;
+   std::vector<Double_t> x(n * dim);
+   std::vector<Double_t> w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      // few distinct values so that bins get filled more than once
+      for (Int_t d = 0; d < dim; ++d)
+         x[i * dim + d] = rng.Integer(3) - 1.5 + 0.01 * d;
+      w[i] = rng.Uniform(0.5, 1.5);
+   }
+   for (Int_t i = 0; i < n; ++i)
+      hFill.Fill(&x[i * dim], w[i]);
+   hFillN.FillN(n, x.data(), w.data());
+
+   EXPECT_EQ(hFill.GetNbins(), hFillN.GetNbins());
+   EXPECT_DOUBLE_EQ(hFill.GetEntries(), hFillN.GetEntries());
+   EXPECT_DOUBLE_EQ(hFill.GetWeightSum(), hFillN.GetWeightSum());
+   const THnSparseD &cFillN = hFillN; // lookups only, do not allocate bins
+   Int_t coord[dim];
+   for (Long64_t bin = 0; bin < hFill.GetNbins(); ++bin) {
+      const Double_t content = hFill.GetBinContent(bin, coord);
+      const Long64_t binN = cFillN.GetBin(coord);
+      ASSERT_GE(binN, 0);
+      EXPECT_DOUBLE_EQ(content, hFillN.GetBinContent(binN));
+      EXPECT_DOUBLE_EQ(hFill.GetBinError(bin), hFillN.GetBinError(binN));
+   }
+
+   // an empty bin is not found and not allocated by a const lookup
+   for (Int_t d = 0; d < dim; ++d)
+      coord[d] = 1;
+   EXPECT_EQ(-1, cFillN.GetBin(coord));
+   EXPECT_EQ(hFill.GetNbins(), hFillN.GetNbins());
+}
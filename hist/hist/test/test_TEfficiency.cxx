@@ -5,6 +5,8 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -400,3 +402,67 @@ TEST(TFEfficiency, ConsistencyWithTGraph)
 {
    testConsistencyWithTGraph();
 }
+
+// FillN gives the same result as Fill, and the intervals computed by ComputeIntervals are those of
+// GetEfficiencyErrorLow/Up and follow the changes of the efficiency
+TEST(TFEfficiency, FillNAndComputeIntervals)
+{
+   TRandom rng(7);
+   const int n = 5000;
+   std::vector<double> x(n), y(n), w(n);
+   std::unique_ptr<Bool_t[]> passed(new Bool_t[n]);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rng.Uniform(-1, 11);
+      y[i] = rng.Uniform(0, 5);
+      w[i] = rng.Uniform(0.5, 1.5);
+      passed[i] = rng.Rndm() < x[i] / 10;
+   }
+
+   TEfficiency eFill("eFill", "", 20, 0, 10, 5, 0, 5);
+   TEfficiency eFillN(eFill);
+   eFillN.SetName("eFillN");
+   for (int i = 0; i < n; ++i)
+      eFill.Fill(passed[i], x[i], y[i]);
+   eFillN.FillN(n, passed.get(), x.data(), y.data());
+   const int ncells = eFill.GetTotalHistogram()->GetNcells();
+   for (int bin = 0; bin < ncells; ++bin) {
+      EXPECT_EQ(eFill.GetTotalHistogram()->GetBinContent(bin), eFillN.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(eFill.GetPassedHistogram()->GetBinContent(bin), eFillN.GetPassedHistogram()->GetBinContent(bin));
+   }
+
+   for (auto statOpt : {TEfficiency::kFCP, TEfficiency::kBJeffrey}) {
+      eFill.SetStatisticOption(statOpt);
+      eFillN.SetStatisticOption(statOpt);
+      eFillN.ComputeIntervals();
+      for (int bin = 0; bin < ncells; ++bin) {
+         EXPECT_EQ(eFill.GetEfficiencyErrorLow(bin), eFillN.GetEfficiencyErrorLow(bin));
+         EXPECT_EQ(eFill.GetEfficiencyErrorUp(bin), eFillN.GetEfficiencyErrorUp(bin));
+      }
+   }
+
+   // filling a bin after computing the intervals
+   const int bin = eFillN.FindFixBin(5.1, 2.1);
+   eFillN.Fill(true, 5.1, 2.1);
+   eFill.Fill(true, 5.1, 2.1);
+   EXPECT_EQ(eFill.GetEfficiencyErrorLow(bin), eFillN.GetEfficiencyErrorLow(bin));
+   EXPECT_EQ(eFill.GetEfficiencyErrorUp(bin), eFillN.GetEfficiencyErrorUp(bin));
+   eFill.SetConfidenceLevel(0.95);
+   eFillN.SetConfidenceLevel(0.95);
+   EXPECT_EQ(eFill.GetEfficiencyErrorUp(bin + 1), eFillN.GetEfficiencyErrorUp(bin + 1));
+
+   // weighted events
+   TEfficiency eWeighted("eWeighted", "", 20, 0, 10);
+   TEfficiency eWeightedN(eWeighted);
+   eWeightedN.SetName("eWeightedN");
+   for (int i = 0; i < n; ++i)
+      eWeighted.FillWeighted(passed[i], w[i], x[i]);
+   eWeightedN.FillN(n, passed.get(), x.data(), nullptr, nullptr, w.data());
+   EXPECT_TRUE(eWeightedN.UsesWeights());
+   eWeighted.SetStatisticOption(TEfficiency::kBUniform);
+   eWeightedN.SetStatisticOption(TEfficiency::kBUniform);
+   eWeightedN.ComputeIntervals();
+   for (int b = 1; b <= 20; ++b) {
+      EXPECT_DOUBLE_EQ(eWeighted.GetEfficiencyErrorLow(b), eWeightedN.GetEfficiencyErrorLow(b));
+      EXPECT_DOUBLE_EQ(eWeighted.GetEfficiencyErrorUp(b), eWeightedN.GetEfficiencyErrorUp(b));
+   }
+}
@@ -2,8 +2,46 @@
 
 #include "TFormula.h"
 
+#include <cmath>
+#include <vector>
+
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Batch evaluation gives the same results as evaluating point by point, up to rounding
+TEST(TFormula, EvalParBatch)
+{
+  TFormula f1("f1", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]*y");
+  f1.SetParameters(2., 0.5, 1.5, -0.25);
+  // same expression with a different spelling shares the compiled batch loop
+  TFormula f2("f2", "[0] * exp(-0.5 * ((x - [1]) / [2])^2) + [3] * y");
+  f2.SetParameters(1., -1., 0.5, 4.);
+  TFormula f3("f3", "x^2 + sqrt(abs(y))");
+
+  const int n = 1001;
+  std::vector<double> x(2 * n);
+  for (int i = 0; i < n; ++i) {
+    x[2 * i] = -5. + 0.01 * i;
+    x[2 * i + 1] = 3. - 0.007 * i;
+  }
+  const double params[] = {3., 0., 2., 1.};
+  // the batch loop is compiled with optimization, which can change the rounding
+  const double tolerance = 1e-12;
+
+  std::vector<double> result(n);
+  for (const TFormula *f : {&f1, &f2, &f3}) {
+    f->EvalPar(x.data(), n, result.data());
+    for (int i = 0; i < n; ++i) {
+      const double expected = f->EvalPar(&x[2 * i]);
+      EXPECT_NEAR(result[i], expected, tolerance * std::abs(expected)) << f->GetName() << " at point " << i;
+    }
+  }
+  f1.EvalPar(x.data(), n, result.data(), params);
+  for (int i = 0; i < n; ++i) {
+    const double expected = f1.EvalPar(&x[2 * i], params);
+    EXPECT_NEAR(result[i], expected, tolerance * std::abs(expected)) << "at point " << i;
+  }
+}
@@ -1,9 +1,19 @@
 #include "gtest/gtest.h"
 
+#include "ROOT/TestSupport.hxx"
+
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
 #include "THLimitsFinder.h"
+#include "TRandom3.h"
 
+#include <cmath>
+#include <thread>
 #include <vector>
 
 // StatOverflows TH1
@@ -63,3 +73,255 @@ TEST(TH1, SmoothArrayCrossCheck)
       EXPECT_FLOAT_EQ(arr2[i], 1.0);
    }
 }
+
+// Expect the histograms to have identical content, errors and statistics
+static void ExpectSameHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   double stats1[TH1::kNstat], stats2[TH1::kNstat];
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_EQ(stats1[i], stats2[i]) << "stat " << i;
+}
+
+// FillN looks up bins in batches, it must give the same result as Fill
+TEST(TH1, FillNSameAsFill)
+{
+   TRandom3 rng(1);
+   const int n = 10000;
+   std::vector<double> x(n), y(n), z(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rng.Gaus(0, 3);
+      y[i] = rng.Gaus(1, 2);
+      z[i] = rng.Uniform(-6, 6);
+      w[i] = i < n / 2 ? 1. : rng.Uniform(0, 2); // Sumw2 is only triggered halfway
+   }
+   x[0] = NAN;
+   x[1] = -5; // lower edge
+   x[2] = 5;  // upper edge
+   const std::vector<double> edges{-5, -4.5, -2, -1, -0.5, 0, 0.1, 0.2, 0.5, 2, 3, 5};
+
+   for (bool variableBins : {false, true}) {
+      TH1D hFill("hFill", "", 11, -5, 5);
+      if (variableBins)
+         hFill.SetBins(edges.size() - 1, edges.data());
+      TH1D hFillN(hFill);
+      for (int i = 0; i < n; ++i)
+         hFill.Fill(x[i], w[i]);
+      hFillN.FillN(n, x.data(), w.data());
+      ExpectSameHistograms(hFill, hFillN);
+
+      // strided, unweighted
+      TH1D hFill2(hFill), hFillN2(hFill);
+      hFill2.Reset();
+      hFillN2.Reset();
+      for (int i = 0; i < n; i += 2)
+         hFill2.Fill(x[i]);
+      hFillN2.FillN(n / 2, x.data(), nullptr, 2);
+      ExpectSameHistograms(hFill2, hFillN2);
+   }
+
+   TH2D h2Fill("h2Fill", "", 10, -5, 5, edges.size() - 1, edges.data());
+   TH2D h2FillN(h2Fill);
+   for (int i = 0; i < n; ++i)
+      h2Fill.Fill(x[i], y[i], w[i]);
+   h2FillN.FillN(n, x.data(), y.data(), w.data());
+   ExpectSameHistograms(h2Fill, h2FillN);
+
+   TH3D h3Fill("h3Fill", "", 10, -5, 5, 7, -3, 4, 12, -5, 5);
+   TH3D h3FillN(h3Fill);
+   for (int i = 0; i < n; ++i)
+      h3Fill.Fill(x[i], y[i], z[i], w[i]);
+   h3FillN.FillN(n, x.data(), y.data(), z.data(), w.data());
+   ExpectSameHistograms(h3Fill, h3FillN);
+
+   // histograms with extendable axes still go through the generic path
+   TH1D hExtFill("hExtFill", "", 10, 0, 1);
+   hExtFill.SetCanExtend(TH1::kAllAxes);
+   TH1D hExtFillN(hExtFill);
+   for (int i = 1; i < n; ++i)
+      hExtFill.Fill(x[i], w[i]);
+   hExtFillN.FillN(n - 1, x.data() + 1, w.data() + 1);
+   ExpectSameHistograms(hExtFill, hExtFillN);
+}
+
+// Expect the profiles to have identical bins; the statistics of FillN are summed with compensation
+// and may differ from those of Fill by rounding
+static void ExpectSameProfiles(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   double stats1[TH1::kNstat], stats2[TH1::kNstat];
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_NEAR(stats1[i], stats2[i], 1e-12 * std::abs(stats1[i])) << "stat " << i;
+}
+
+TEST(TProfile, FillNSameAsFill)
+{
+   TRandom3 rng(1);
+   const int n = 10000;
+   std::vector<double> x(n), y(n), z(n), t(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rng.Gaus(0, 3);
+      y[i] = rng.Gaus(1, 2);
+      z[i] = rng.Uniform(-6, 6);
+      t[i] = rng.Gaus(10, 1);
+      w[i] = i < n / 2 ? 1. : rng.Uniform(0, 2); // Sumw2 is only triggered halfway
+   }
+   t[0] = NAN;
+
+   TProfile pFill("pFill", "", 10, -5, 5, 8, 12); // entries outside of [8, 12] are ignored
+   TProfile pFillN(pFill);
+   for (int i = 0; i < n; ++i)
+      pFill.Fill(x[i], t[i], w[i]);
+   pFillN.FillN(n, x.data(), t.data(), w.data());
+   ExpectSameProfiles(pFill, pFillN);
+
+   // strided, unweighted
+   TProfile pFill2("pFill2", "", 10, -5, 5);
+   TProfile pFillN2(pFill2);
+   for (int i = 0; i < n; i += 2)
+      pFill2.Fill(x[i], t[i]);
+   pFillN2.FillN(n / 2, x.data(), t.data(), nullptr, 2);
+   ExpectSameProfiles(pFill2, pFillN2);
+
+   TProfile2D p2Fill("p2Fill", "", 10, -5, 5, 7, -3, 4);
+   TProfile2D p2FillN(p2Fill);
+   for (int i = 0; i < n; ++i)
+      p2Fill.Fill(x[i], y[i], t[i], w[i]);
+   p2FillN.FillN(n, x.data(), y.data(), t.data(), w.data());
+   ExpectSameProfiles(p2Fill, p2FillN);
+
+   TProfile3D p3Fill("p3Fill", "", 10, -5, 5, 7, -3, 4, 12, -5, 5);
+   TProfile3D p3FillN(p3Fill);
+   for (int i = 0; i < n; ++i)
+      p3Fill.Fill(x[i], y[i], z[i], t[i], w[i]);
+   p3FillN.FillN(n, x.data(), y.data(), z.data(), t.data(), w.data());
+   ExpectSameProfiles(p3Fill, p3FillN);
+}
+
+// The statistics of TProfile::FillN keep their precision for values with a large offset
+TEST(TProfile, FillNCompensatedStats)
+{
+   // y and y*y are exact in double precision, summing y*y naively is off by more than 1000
+   const int n = 1000000;
+   const double eps = std::ldexp(1., -13);
+   std::vector<double> x(n, 0.5), y(n);
+   for (int i = 0; i < n; ++i)
+      y[i] = 1e4 + (i % 2 ? eps : -eps);
+   TProfile p("p", "", 1, 0, 1);
+   p.FillN(n, x.data(), y.data(), nullptr);
+   double stats[TH1::kNstat];
+   p.GetStats(stats);
+   EXPECT_EQ(stats[4], 1e4 * n);
+   EXPECT_NEAR(stats[5], n * (1e8 + eps * eps), 0.1);
+}
+
+// Filling one histogram from several threads gives the same result as filling it from one
+TEST(TH1, ConcurrentFill)
+{
+   // values and weights chosen such that all sums are exact whatever the order of the additions
+   const int n = 40000;
+   const int nThreads = 4;
+   std::vector<double> x(n), y(n), z(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = (i % 48) * 0.25 - 6;
+      y[i] = (i % 13) * 0.5 - 3;
+      z[i] = (i % 7) - 3;
+      w[i] = 1 + i % 2;
+   }
+
+   auto fillConcurrently = [&](TH1 &h, auto fill) {
+      h.SetConcurrentFill();
+      EXPECT_TRUE(h.IsConcurrentFill());
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nThreads; ++t) {
+         threads.emplace_back([&, t] {
+            for (int i = t; i < n; i += nThreads)
+               fill(i);
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   };
+
+   TH1D h1("h1", "", 20, -5, 5);
+   h1.Sumw2();
+   TH1D h1Concurrent(h1);
+   for (int i = 0; i < n; ++i)
+      h1.Fill(x[i], w[i]);
+   fillConcurrently(h1Concurrent, [&](int i) { h1Concurrent.Fill(x[i], w[i]); });
+   ExpectSameHistograms(h1, h1Concurrent);
+
+   TH2F h2("h2", "", 10, -5, 5, 8, -2, 2);
+   TH2F h2Concurrent(h2);
+   for (int i = 0; i < n; ++i)
+      h2.Fill(x[i], y[i]);
+   fillConcurrently(h2Concurrent, [&](int i) { h2Concurrent.Fill(x[i], y[i]); });
+   ExpectSameHistograms(h2, h2Concurrent);
+
+   TH3D h3("h3", "", 10, -5, 5, 8, -2, 2, 5, -2, 3);
+   h3.Sumw2();
+   TH3D h3Concurrent(h3);
+   h3.FillN(n, x.data(), y.data(), z.data(), w.data());
+   fillConcurrently(h3Concurrent, [&](int i) { h3Concurrent.FillN(1, &x[i], &y[i], &z[i], &w[i]); });
+   ExpectSameHistograms(h3, h3Concurrent);
+
+   // the statistics are folded into the histogram when leaving the concurrent mode
+   h3Concurrent.SetConcurrentFill(kFALSE);
+   EXPECT_FALSE(h3Concurrent.IsConcurrentFill());
+   ExpectSameHistograms(h3, h3Concurrent);
+   h3Concurrent.Reset();
+   EXPECT_EQ(h3Concurrent.GetEntries(), 0);
+
+   // copying into a histogram in concurrent mode discards its pending statistics, its threads then fill the new
+   // bin contents
+   TH1D hCopy("hCopy", "", 5, 0, 1);
+   fillConcurrently(hCopy, [&](int) { hCopy.Fill(0.5); });
+   h1.Copy(hCopy);
+   EXPECT_TRUE(hCopy.IsConcurrentFill());
+   ExpectSameHistograms(h1, hCopy);
+   for (int i = 0; i < n; ++i)
+      h1.Fill(x[i], w[i]);
+   fillConcurrently(hCopy, [&](int i) { hCopy.Fill(x[i], w[i]); });
+   ExpectSameHistograms(h1, hCopy);
+
+   // ResetStats and PutStats neither lose nor double count the pending statistics of the threads
+   for (int i = 0; i < n; ++i)
+      h1.Fill(x[i], w[i]);
+   fillConcurrently(hCopy, [&](int i) { hCopy.Fill(x[i], w[i]); });
+   h1.ResetStats();
+   hCopy.ResetStats();
+   ExpectSameHistograms(h1, hCopy);
+   for (int i = 0; i < n; ++i)
+      h1.Fill(x[i], w[i]);
+   fillConcurrently(hCopy, [&](int i) { hCopy.Fill(x[i], w[i]); });
+   double stats[TH1::kNstat];
+   h1.GetStats(stats);
+   hCopy.PutStats(stats);
+   EXPECT_EQ(h1.GetEntries(), hCopy.GetEntries());
+   ExpectSameHistograms(h1, hCopy);
+
+   // not supported for extendable axes and integer contents
+   TH1D hExt("hExt", "", 10, 0, 1);
+   hExt.SetCanExtend(TH1::kAllAxes);
+   ROOT_EXPECT_ERROR(hExt.SetConcurrentFill(), "TH1D::SetConcurrentFill",
+                     "concurrent filling is not supported for histograms with extendable axes");
+   EXPECT_FALSE(hExt.IsConcurrentFill());
+   TH1I hInt("hInt", "", 10, 0, 1);
+   ROOT_EXPECT_ERROR(hInt.SetConcurrentFill(), "TH1I::SetConcurrentFill",
+                     "concurrent filling is only supported for histograms of doubles or floats");
+   EXPECT_FALSE(hInt.IsConcurrentFill());
+}
@@ -1,11 +1,14 @@
+#include "TGraph.h"
 #include "TSpline.h"
 #include "TInterpreter.h"
 #include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <cmath>
 #include <fstream>
 #include <string>
+#include <vector>
 
 class FileDeleterRAII {
    const std::string fFileName;
@@ -49,4 +52,65 @@ TEST(TSpline, Precision)
          << "Spline value (" << splineVal << ") and expected value (" << expectedVal << ") differ more than allowed ("
          << tolerance << ")" << std::endl;
    }
-}
\ No newline at end of file
+}
+
+// Batch evaluation gives the same result as evaluating each value
+TEST(TSpline, EvalN)
+{
+   const int np = 20;
+   std::vector<double> xp(np), yp(np);
+   for (int i = 0; i < np; ++i) {
+      xp[i] = i * i * 0.05; // non-equidistant knots
+      yp[i] = std::sin(xp[i]);
+   }
+   // sorted values, unsorted values, values outside of the range and on the knots
+   std::vector<double> x;
+   for (int i = -10; i < 250; ++i)
+      x.push_back(i * 0.1);
+   for (int i = 0; i < 100; ++i)
+      x.push_back(std::fmod(i * 7.3, 22.) - 1);
+   x.insert(x.end(), xp.begin(), xp.end());
+   std::vector<double> y(x.size());
+
+   TSpline3 s3("s3", xp.data(), yp.data(), np);
+   s3.EvalN(x.size(), x.data(), y.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_EQ(y[i], s3.Eval(x[i])) << "x = " << x[i];
+
+   TSpline5 s5("s5", xp.data(), yp.data(), np);
+   s5.EvalN(x.size(), x.data(), y.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_EQ(y[i], s5.Eval(x[i])) << "x = " << x[i];
+
+   TGraph g(np, xp.data(), yp.data());
+   for (auto option : {"", "S"}) {
+      for (bool sorted : {false, true}) {
+         g.SetBit(TGraph::kIsSortedX, sorted);
+         g.EvalN(x.size(), x.data(), y.data(), nullptr, option);
+         for (std::size_t i = 0; i < x.size(); ++i)
+            EXPECT_EQ(y[i], g.Eval(x[i], nullptr, option)) << "x = " << x[i] << ", option " << option;
+      }
+   }
+
+   // the spline used by option "S" follows the changes of the points
+   g.SetPoint(5, xp[5], 10.);
+   TSpline3 s3Changed("s3Changed", &g);
+   EXPECT_EQ(g.Eval(xp[5] + 0.01, nullptr, "S"), s3Changed.Eval(xp[5] + 0.01));
+   g.RemovePoint(5);
+   TSpline3 s3Removed("s3Removed", &g);
+   EXPECT_EQ(g.Eval(xp[5] + 0.01, nullptr, "S"), s3Removed.Eval(xp[5] + 0.01));
+   // also when they are changed directly in the arrays
+   g.GetY()[6] = -10.;
+   TSpline3 s3ChangedY("s3ChangedY", &g);
+   EXPECT_EQ(g.Eval(xp[6] + 0.01, nullptr, "S"), s3ChangedY.Eval(xp[6] + 0.01));
+   g.GetX()[6] += 0.02;
+   TSpline3 s3ChangedX("s3ChangedX", &g);
+   EXPECT_EQ(g.Eval(xp[6] + 0.01, nullptr, "S"), s3ChangedX.Eval(xp[6] + 0.01));
+
+   // copies build their own spline
+   TGraph gCopy(g);
+   g.Set(np / 2);
+   TSpline3 s3Shrunk("s3Shrunk", &g);
+   EXPECT_EQ(g.Eval(xp[3] + 0.01, nullptr, "S"), s3Shrunk.Eval(xp[3] + 0.01));
+   EXPECT_EQ(gCopy.Eval(xp[12] + 0.01, nullptr, "S"), s3Removed.Eval(xp[12] + 0.01));
+}
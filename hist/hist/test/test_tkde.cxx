@@ -10,6 +10,10 @@
 #include "TH1.h"
 #include "Math/DistFuncMathCore.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 
 struct TestKDE {
 
@@ -496,4 +500,31 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+
+// grid evaluation must agree with the exact one within the tolerance, relative to the density maximum
+TEST(TKDE, tkde_grid)
+{
+   for (bool adaptive : {false, true}) {
+      TestKDE t;
+      t.makePlot = false;
+      t.adaptive = adaptive;
+      t.mirroring = true;
+      t.mirror = "MirrorAsymLeft";
+      std::unique_ptr<TKDE> kde(t.Create());
+      const int npx = 1001;
+      std::vector<double> x(npx), exact(npx), grid(npx);
+      for (int i = 0; i < npx; ++i)
+         x[i] = 20. * i / (npx - 1);
+      kde->GetValues(npx, x.data(), exact.data());
+      const double tolerance = 1.E-4;
+      kde->SetGridTolerance(tolerance);
+      kde->SetEvaluation(TKDE::kGridEvaluation);
+      kde->GetValues(npx, x.data(), grid.data());
+      const double maximum = *std::max_element(exact.begin(), exact.end());
+      for (int i = 0; i < npx; ++i) {
+         EXPECT_NEAR(exact[i], grid[i], tolerance * maximum) << "at x = " << x[i] << (adaptive ? " (adaptive)" : "");
+         EXPECT_DOUBLE_EQ(grid[i], (*kde)(x[i]));
+      }
+   }
+}
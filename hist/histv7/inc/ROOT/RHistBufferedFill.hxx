@@ -37,7 +37,7 @@ private:
 
 public:
    RHistBufferedFillBase() {}
-   ~RHistBufferedFillBase() { toDerived().Flush(); }
+   // Derived classes must call Flush() from their destructor: they are already destructed in ours.
 
    DERIVED &toDerived() { return *static_cast<DERIVED *>(this); }
    const DERIVED &toDerived() const { return *static_cast<const DERIVED *>(this); }
@@ -64,6 +64,10 @@ public:
       toDerived().FlushImpl();
       fCursor = 0;
    }
+
+protected:
+   /// Drop the buffered fills, for derived classes that handed them over to another object.
+   void DiscardBuffer() { fCursor = 0; }
 };
 
 } // namespace Internal
@@ -95,6 +99,7 @@ private:
 
 public:
    RHistBufferedFill(Hist_t &hist): fHist{hist} {}
+   ~RHistBufferedFill() { this->Flush(); }
 
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
    {
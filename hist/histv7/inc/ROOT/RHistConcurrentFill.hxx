@@ -19,7 +19,10 @@
 #include "ROOT/RSpan.hxx"
 #include "ROOT/RHistBufferedFill.hxx"
 
+#include <cstddef>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -27,39 +30,134 @@ namespace Experimental {
 template <class HIST, int SIZE>
 class RHistConcurrentFillManager;
 
+/// How the RHistConcurrentFiller objects of a RHistConcurrentFillManager get their fills into the histogram.
+enum class EConcurrentFillMode {
+   kAuto,   ///< kSharded while the shards fit in the manager's memory budget, kLocked for further fillers
+   kLocked, ///< Fillers fill the histogram itself, one at a time
+   kSharded ///< Fillers fill a private copy of the histogram without locking, added to the histogram by Flush()
+};
+
 /**
  \class RHistConcurrentFiller
  Buffers a thread's Fill calls and submits them to the
  RHistConcurrentFillManager. Enables multi-threaded filling.
+
+ If the manager made this filler a sharded one, the buffered fills go to a
+ shard, i.e. a private copy of the histogram, without any locking. The shard is
+ taken from the manager on the first fill; Flush() and the destructor add its
+ content to the histogram and give it back to the manager, for reuse by this or
+ any other filler. Otherwise the fills go to the histogram itself, under the
+ manager's lock.
+
+ Fillers cannot be copied, as two copies would fill the same shard. Moving a
+ filler hands its shard and its buffered fills over to the new object.
  **/
 
 template <class HIST, int SIZE>
 class RHistConcurrentFiller: public Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE> {
-   RHistConcurrentFillManager<HIST, SIZE> &fManager;
+   using Base_t = Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>;
+
+   RHistConcurrentFillManager<HIST, SIZE> *fManager;
+   bool fSharded = false;  ///< Whether fills go to a shard instead of the histogram itself.
+   HIST *fShard = nullptr; ///< Shard with fills not yet added to the histogram, owned by fManager; nullptr if none.
 
 public:
    using CoordArray_t = typename HIST::CoordArray_t;
    using Weight_t = typename HIST::Weight_t;
 
-   RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager): fManager(manager) {}
+   RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager, bool sharded = false)
+      : fManager(&manager), fSharded(sharded)
+   {
+   }
+   RHistConcurrentFiller(const RHistConcurrentFiller &) = delete;
+   RHistConcurrentFiller &operator=(const RHistConcurrentFiller &) = delete;
+   RHistConcurrentFiller(RHistConcurrentFiller &&other)
+      : Base_t(other), fManager(other.fManager), fSharded(other.fSharded), fShard(other.fShard)
+   {
+      other.Release();
+   }
+   RHistConcurrentFiller &operator=(RHistConcurrentFiller &&other)
+   {
+      if (this != &other) {
+         Flush();
+         if (fSharded)
+            fManager->ReleaseShardedFiller();
+         Base_t::operator=(other);
+         fManager = other.fManager;
+         fSharded = other.fSharded;
+         fShard = other.fShard;
+         other.Release();
+      }
+      return *this;
+   }
+   ~RHistConcurrentFiller()
+   {
+      Flush();
+      if (fSharded)
+         fManager->ReleaseShardedFiller();
+   }
 
    /// Thread-specific HIST::Fill().
-   using Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>::Fill;
+   using Base_t::Fill;
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
    {
-      fManager.FillN(xN, weightN);
+      if (fSharded) {
+         GetShard().FillN(xN, weightN);
+      } else {
+         fManager->FillN(xN, weightN);
+      }
    }
 
    /// Thread-specific HIST::FillN().
-   void FillN(const std::span<const CoordArray_t> xN) { fManager.FillN(xN); }
+   void FillN(const std::span<const CoordArray_t> xN)
+   {
+      if (fSharded) {
+         GetShard().FillN(xN);
+      } else {
+         fManager->FillN(xN);
+      }
+   }
+
+   /// Submit the buffered fills and make all fills of this filler visible in the histogram.
+   void Flush()
+   {
+      Base_t::Flush();
+      if (fShard) {
+         fManager->AddShard(fShard);
+         fShard = nullptr;
+      }
+   }
+
+   /// Whether this filler fills a private copy of the histogram, see EConcurrentFillMode::kSharded.
+   bool IsSharded() const { return fSharded; }
 
    static constexpr int GetNDim() { return HIST::GetNDim(); }
 
 private:
-   friend class Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>;
-   void FlushImpl() { fManager.FillN(this->GetCoords(), this->GetWeights()); }
+   friend Base_t;
+
+   /// Leave a moved-from filler without buffered fills and without shard: it fills under the lock if used again.
+   void Release()
+   {
+      this->DiscardBuffer();
+      fSharded = false;
+      fShard = nullptr;
+   }
+
+   HIST &GetShard()
+   {
+      if (!fShard)
+         fShard = fManager->AcquireShard();
+      return *fShard;
+   }
+
+   void FlushImpl()
+   {
+      if (!this->GetCoords().empty())
+         FillN(this->GetCoords(), this->GetWeights());
+   }
 };
 
 /**
@@ -68,9 +166,23 @@ private:
 
  The HIST template can be a RHist instance. This class hands out
  RHistConcurrentFiller objects that can concurrently fill the histogram. They
- buffer calls to Fill() until the buffer is full, and then swap the buffer
- with that of the RHistConcurrentFillManager. The manager than fills the
- histogram.
+ buffer calls to Fill() until the buffer is full, and then send the buffer
+ to the histogram.
+
+ Small histograms are best filled through shards: each filler gets its own
+ copy of the histogram that it fills without any synchronization; the manager
+ adds it to the histogram when the filler is flushed or destructed. That costs
+ up to one copy of the histogram per live filler, i.e. per thread, so for large
+ histograms (or many threads) the fillers instead fill the histogram itself,
+ serialized by a lock, where the contention is lower anyway because the time
+ spent filling is dominated by cache misses on the bins. With
+ EConcurrentFillMode::kAuto the manager makes fillers sharded as long as one
+ shard for each live sharded filler fits in `maxShardBytes`. Shards that were
+ added to the histogram are kept for reuse, so filling with a sequence of
+ short-lived fillers allocates no more shards than were filling at the same
+ time.
+ Histograms with growing axes cannot be sharded, as the shards' binning could
+ diverge.
  **/
 
 template <class HIST, int SIZE = 1024>
@@ -82,14 +194,95 @@ public:
    using CoordArray_t = typename HIST::CoordArray_t;
    using Weight_t = typename HIST::Weight_t;
 
+   /// Default memory budget for the shards of EConcurrentFillMode::kAuto.
+   static constexpr std::size_t kDefaultMaxShardBytes = 64 * 1024 * 1024;
+
 private:
    HIST &fHist;
-   std::mutex fFillMutex; // should become a spin lock
+   EConcurrentFillMode fMode;
+   std::size_t fMaxShardBytes;
+   std::vector<std::unique_ptr<HIST>> fShards; ///< All shards, kept until the manager is destructed.
+   std::vector<HIST *> fFreeShards;            ///< Empty shards not used by any filler.
+   std::size_t fNShardedFillers = 0;           ///< Number of live sharded fillers.
+   std::mutex fFillMutex;                      ///< Protects fHist, fShards, fFreeShards and fNShardedFillers.
+
+   /// Approximate memory used by one shard: its bin contents and, if stored, their uncertainties.
+   std::size_t GetShardBytes() const
+   {
+      using Stat_t = typename HIST::ImplBase_t::Stat_t;
+      return fHist.GetImpl()->GetNBins() * sizeof(Weight_t) * (Stat_t::HasBinUncertainty() ? 2 : 1);
+   }
+
+   bool CanShard() const
+   {
+      for (int i = 0; i < HIST::GetNDim(); ++i) {
+         if (fHist.GetImpl()->GetAxis(i).CanGrow())
+            return false;
+      }
+      return true;
+   }
+
+   /// Reset the statistics of a shard to those of an empty histogram.
+   static void ResetShard(HIST &shard)
+   {
+      auto &impl = *shard.GetImpl();
+      impl.GetStat() = typename HIST::ImplBase_t::Stat_t(impl.GetNBinsNoOver(), impl.GetNOverflowBins());
+   }
+
+   /// Hand out an empty shard to a sharded filler, reusing a free one if possible.
+   HIST *AcquireShard()
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      if (!fFreeShards.empty()) {
+         HIST *shard = fFreeShards.back();
+         fFreeShards.pop_back();
+         return shard;
+      }
+      fShards.emplace_back(std::make_unique<HIST>(fHist));
+      ResetShard(*fShards.back());
+      return fShards.back().get();
+   }
+
+   /// Add the content of a filler's shard to the histogram, reset the shard and make it free for reuse.
+   void AddShard(HIST *shard)
+   {
+      {
+         std::lock_guard<std::mutex> lockGuard(fFillMutex);
+         Add(fHist, *shard);
+      }
+      ResetShard(*shard);
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      fFreeShards.push_back(shard);
+   }
+
+   /// A sharded filler is destructed or overwritten: it does not count against the shard budget anymore.
+   void ReleaseShardedFiller()
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      --fNShardedFillers;
+   }
 
 public:
-   RHistConcurrentFillManager(HIST &hist): fHist(hist) {}
+   RHistConcurrentFillManager(HIST &hist, EConcurrentFillMode mode = EConcurrentFillMode::kAuto,
+                              std::size_t maxShardBytes = kDefaultMaxShardBytes)
+      : fHist(hist), fMode(mode), fMaxShardBytes(maxShardBytes)
+   {
+   }
 
-   RHistConcurrentFiller<HIST, SIZE> MakeFiller() { return RHistConcurrentFiller<HIST, SIZE>{*this}; }
+   /// Create a filler for one thread, see EConcurrentFillMode for how it fills the histogram.
+   /// Fillers must not outlive their manager.
+   RHistConcurrentFiller<HIST, SIZE> MakeFiller()
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      bool shard = false;
+      if (fMode == EConcurrentFillMode::kSharded)
+         shard = CanShard();
+      else if (fMode == EConcurrentFillMode::kAuto)
+         shard = CanShard() && (fNShardedFillers + 1) * GetShardBytes() <= fMaxShardBytes;
+      if (shard)
+         ++fNShardedFillers;
+      return RHistConcurrentFiller<HIST, SIZE>{*this, shard};
+   }
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
@@ -0,0 +1,72 @@
+/// \file concurrentfillspeed.cxx
+///
+/// Measures the throughput of RHistConcurrentFillManager for each EConcurrentFillMode, for growing histogram sizes
+/// and thread counts. Build and run with
+///
+///     g++ -o concurrentfillspeed concurrentfillspeed.cxx `root-config --cflags --libs` -O3
+///     ./concurrentfillspeed [entries per thread]
+///
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistConcurrentFill.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+using Filler_t = RHistConcurrentFiller<RH2D, 1024>;
+
+void Fill(Filler_t filler, long nEntries, unsigned seed)
+{
+   std::mt19937_64 gen(seed);
+   std::uniform_real_distribution<double> dist(0., 1.);
+   for (long i = 0; i < nEntries; ++i)
+      filler.Fill({dist(gen), dist(gen)});
+}
+
+/// Return the wall time in seconds to fill `hist` with `nEntries` entries from each of `nThreads` threads.
+double Time(RH2D &hist, EConcurrentFillMode mode, unsigned nThreads, long nEntries)
+{
+   auto start = std::chrono::steady_clock::now();
+   {
+      RHistConcurrentFillManager<RH2D> fillMgr(hist, mode);
+      std::vector<std::thread> threads;
+      for (unsigned i = 0; i < nThreads; ++i)
+         threads.emplace_back(Fill, fillMgr.MakeFiller(), nEntries, i);
+      for (auto &thr : threads)
+         thr.join();
+   }
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+   const long nEntries = argc > 1 ? std::atol(argv[1]) : 10000000;
+   const unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+   const std::pair<const char *, EConcurrentFillMode> modes[] = {
+      {"locked", EConcurrentFillMode::kLocked},
+      {"sharded", EConcurrentFillMode::kSharded},
+      {"auto", EConcurrentFillMode::kAuto}};
+
+   std::cout << "bins\tthreads\tmode\tMfills/s\n";
+   for (int nBinsPerAxis : {10, 100, 1000, 3000}) {
+      for (unsigned nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+         for (const auto &mode : modes) {
+            RH2D hist{{nBinsPerAxis, 0., 1.}, {nBinsPerAxis, 0., 1.}};
+            const double seconds = Time(hist, mode.second, nThreads, nEntries);
+            std::cout << nBinsPerAxis * nBinsPerAxis << '\t' << nThreads << '\t' << mode.first << '\t'
+                      << nThreads * nEntries / seconds / 1e6 << '\n';
+         }
+      }
+   }
+   return 0;
+}
@@ -143,3 +143,114 @@ TEST(ConcurrentFillTest, FillFlush)
    EXPECT_EQ(0, (int)Filler_1.GetCoords().size());
    EXPECT_EQ(0, (int)Filler_2.GetCoords().size());
 }
+
+// Test that all fill modes give the same result, with and without shards
+TEST(ConcurrentFillTest, FillModes)
+{
+   using Mode_t = Experimental::EConcurrentFillMode;
+   for (auto mode : {Mode_t::kLocked, Mode_t::kSharded, Mode_t::kAuto}) {
+      Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+      {
+         Experimental::RHistConcurrentFillManager<Experimental::RH2D> fillMgr(hist, mode);
+         std::array<std::thread, 4> threads;
+         for (auto &thr : threads) {
+            auto filler = fillMgr.MakeFiller();
+            EXPECT_EQ(mode != Mode_t::kLocked, filler.IsSharded());
+            thr = std::thread(fillWithWeights, std::move(filler));
+         }
+         for (auto &thr : threads)
+            thr.join();
+      }
+      EXPECT_EQ(4 * 3000, hist.GetEntries());
+      EXPECT_FLOAT_EQ(4 * 42.f, hist.GetBinContent({(double)42 / 100, (double)42 / 10}));
+      EXPECT_FLOAT_EQ(2.f, hist.GetBinUncertainty({(double)1 / 100, (double)1 / 10}));
+   }
+}
+
+// Test that kAuto stops handing out shards once they exceed the memory budget
+TEST(ConcurrentFillTest, AutoShardBudget)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   // 102 x 6 bins, with content and uncertainty: room for two shards
+   Experimental::RHistConcurrentFillManager<Experimental::RH2D> fillMgr(hist, Experimental::EConcurrentFillMode::kAuto,
+                                                                        2 * 102 * 6 * 2 * sizeof(double));
+   Filler_t filler1 = fillMgr.MakeFiller();
+   Filler_t filler2 = fillMgr.MakeFiller();
+   Filler_t filler3 = fillMgr.MakeFiller();
+   EXPECT_TRUE(filler1.IsSharded());
+   EXPECT_TRUE(filler2.IsSharded());
+   EXPECT_FALSE(filler3.IsSharded());
+
+   // Direct FillN() calls on a sharded filler are visible after Flush().
+   filler1.FillN({{0.1111, 4.22}, {0.3333, 4.44}});
+   EXPECT_EQ(0, hist.GetEntries());
+   filler1.Flush();
+   EXPECT_EQ(2, hist.GetEntries());
+   filler3.FillN({{0.1111, 4.22}, {0.3333, 4.44}});
+   EXPECT_EQ(4, hist.GetEntries());
+   EXPECT_FLOAT_EQ(2.f, hist.GetBinContent({0.1111, 4.22}));
+}
+
+// Test that the kAuto budget counts live fillers: destructed fillers free their shard for the next ones
+TEST(ConcurrentFillTest, AutoShardReuse)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   // room for one shard
+   Experimental::RHistConcurrentFillManager<Experimental::RH2D> fillMgr(hist, Experimental::EConcurrentFillMode::kAuto,
+                                                                        102 * 6 * 2 * sizeof(double));
+   for (int i = 0; i < 3; ++i) {
+      Filler_t filler = fillMgr.MakeFiller();
+      Filler_t lockedFiller = fillMgr.MakeFiller();
+      EXPECT_TRUE(filler.IsSharded());
+      EXPECT_FALSE(lockedFiller.IsSharded());
+      filler.FillN({{0.1111, 4.22}});
+      // A flushed filler stays sharded, and fills a (reused) shard again.
+      filler.Flush();
+      EXPECT_EQ(2 * i + 1, hist.GetEntries());
+      filler.FillN({{0.1111, 4.22}});
+      EXPECT_EQ(2 * i + 1, hist.GetEntries());
+   }
+   EXPECT_EQ(6, hist.GetEntries());
+   EXPECT_FLOAT_EQ(6.f, hist.GetBinContent({0.1111, 4.22}));
+}
+
+// Test that moving a sharded filler hands over its shard and its buffered fills
+TEST(ConcurrentFillTest, MoveShardedFiller)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   {
+      Experimental::RHistConcurrentFillManager<Experimental::RH2D> fillMgr(hist,
+                                                                           Experimental::EConcurrentFillMode::kSharded);
+      Filler_t filler = fillMgr.MakeFiller();
+      ASSERT_TRUE(filler.IsSharded());
+      // buffered, and filled into the shard by the thread
+      for (int i = 0; i < 100; ++i)
+         filler.Fill({0.1111, 4.22});
+      filler.FillN({{0.1111, 4.22}});
+
+      std::thread thr([movedFiller = std::move(filler)]() mutable {
+         EXPECT_TRUE(movedFiller.IsSharded());
+         EXPECT_EQ(100, (int)movedFiller.GetCoords().size());
+         for (int i = 0; i < 3000; ++i)
+            movedFiller.Fill({(double)i / 100, (double)i / 10});
+      });
+
+      // The moved-from filler has neither fills nor shard, and fills the histogram under the lock.
+      EXPECT_FALSE(filler.IsSharded());
+      EXPECT_EQ(0, (int)filler.GetCoords().size());
+      filler.Fill({0.3333, 4.44});
+      thr.join();
+
+      // Move assignment flushes the target first.
+      Filler_t filler2 = fillMgr.MakeFiller();
+      filler2.Fill({0.3333, 4.44});
+      filler = std::move(filler2);
+      EXPECT_TRUE(filler.IsSharded());
+      EXPECT_FALSE(filler2.IsSharded());
+      EXPECT_EQ(1, (int)filler.GetCoords().size());
+   }
+   EXPECT_EQ(100 + 1 + 3000 + 1 + 1, hist.GetEntries());
+   EXPECT_FLOAT_EQ(100.f + 1.f, hist.GetBinContent({0.1111, 4.22}));
+   // the thread's fill at i = 33 falls into the same bin
+   EXPECT_FLOAT_EQ(2.f + 1.f, hist.GetBinContent({0.3333, 4.44}));
+}
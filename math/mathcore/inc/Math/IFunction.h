@@ -89,6 +89,10 @@ namespace ROOT {
          // if it inherits from ROOT::Math::IGradientFunctionMultiDim.
          virtual bool HasGradient() const { return false; }
 
+         // Indicate whether the function (and its gradient) can be evaluated concurrently
+         // from several threads, e.g. by the Minuit2 minimizer with the "NThreads" option.
+         virtual bool IsThreadSafe() const { return false; }
+
       private:
 
          /// Implementation of the evaluation function. Must be implemented by derived classes.
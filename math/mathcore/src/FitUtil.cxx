@@ -213,6 +213,49 @@ namespace ROOT {
             }
          }
 
+         // scratch buffers used when evaluating a single data point, allocated once per chunk of points
+         // and reused for all the points of the chunk (a heap allocation per point dominates cheap model functions)
+         struct PointBuffers {
+            std::vector<double> fXc;       // coordinates of the point (e.g. bin centre)
+            std::vector<double> fX2;       // upper bin edges, for integral fits
+            std::vector<double> fGradFunc; // model function gradient
+
+            PointBuffers(unsigned int ndim, unsigned int npar = 0) : fXc(ndim), fX2(ndim), fGradFunc(npar) {}
+         };
+
+         inline void AddChunkResult(double &res, double chunkRes) { res += chunkRes; }
+         inline void AddChunkResult(std::vector<double> &res, const std::vector<double> &chunkRes)
+         {
+            for (unsigned int k = 0; k < res.size(); ++k)
+               res[k] += chunkRes[k];
+         }
+
+#ifdef R__USE_IMT
+         // evaluate chunkFunction(begin, end) on nChunks contiguous ranges of [0, n) in the thread pool and sum up
+         // the results. Mapping over contiguous ranges rather than single points lets every task reuse its buffers
+         // and accumulators, and keeps the reduction proportional to the number of chunks, not of points
+         template <class T, class ChunkFunction>
+         T MapReduceChunks(unsigned int n, unsigned int nChunks, const ChunkFunction &chunkFunction)
+         {
+            if (nChunks == 0)
+               nChunks = setAutomaticChunking(n);
+            nChunks = std::max(1u, std::min(nChunks, n));
+            auto mapFunction = [&](unsigned int ichunk) {
+               const auto begin = static_cast<unsigned int>(ULong64_t(n) * ichunk / nChunks);
+               const auto end = static_cast<unsigned int>(ULong64_t(n) * (ichunk + 1) / nChunks);
+               return chunkFunction(begin, end);
+            };
+            auto redFunction = [](const std::vector<T> &chunkResults) {
+               T res = chunkResults.front();
+               for (unsigned int i = 1; i < chunkResults.size(); ++i)
+                  AddChunkResult(res, chunkResults[i]);
+               return res;
+            };
+            ROOT::TThreadExecutor pool;
+            return pool.MapReduce(mapFunction, ROOT::TSeq<unsigned int>(0, nChunks), redFunction);
+         }
+#endif
+
 
 
       } // end namespace  FitUtil
@@ -276,7 +319,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   auto mapFunction = [&](const unsigned i, PointBuffers &buf){
 
       double chi2{};
       double fval{};
@@ -288,7 +331,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
       const double * x = nullptr;
-      std::vector<double> xc;
+      auto &xc = buf.fXc;
       double binVolume = 1.0;
       if (useBinVolume) {
          unsigned int ndim = data.NDim();
@@ -326,7 +369,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       else {
          // calculate integral normalized (divided) by bin volume
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         auto &x2 = buf.fX2;
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
       }
@@ -378,11 +421,16 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       return chi2;
   };
 
-#ifdef R__USE_IMT
-  auto redFunction = [](const std::vector<double> & objs){
-                          return std::accumulate(objs.begin(), objs.end(), double{});
+  // evaluate a contiguous range of points, reusing the same buffers
+  auto chunkFunction = [&](unsigned int begin, unsigned int end) {
+     PointBuffers buf(data.NDim());
+     double chunkChi2{};
+     for (unsigned int i = begin; i < end; ++i)
+        chunkChi2 += mapFunction(i, buf);
+     return chunkChi2;
   };
-#else
+
+#ifndef R__USE_IMT
   (void)nChunks;
 
   // If IMT is disabled, force the execution policy to the serial case
@@ -395,14 +443,10 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
   double res{};
   if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      res += mapFunction(i);
-    }
+    res = chunkFunction(0, n);
 #ifdef R__USE_IMT
   } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-    ROOT::TThreadExecutor pool;
-    auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+    res = MapReduceChunks<double>(n, nChunks, chunkFunction);
 #endif
 //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
     // ROOT::TProcessExecutor pool;
@@ -715,12 +759,9 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   std::vector<bool> isPointRejected(initialNPoints);
-
-   auto mapFunction = [&](const unsigned int i) {
-      // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+   // add the contribution of point i to the gradient and return false if the point is rejected
+   auto mapFunction = [&](const unsigned int i, PointBuffers &buf, double *pointContribution) {
+      auto &gradFunc = buf.fGradFunc;
 
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
@@ -731,7 +772,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      auto &xc = buf.fXc;
 
       unsigned int ndim = data.NDim();
       double binVolume = 1;
@@ -762,7 +803,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
          fval = func(x, p);
          func.ParameterGradient(x, p, &gradFunc[0]);
       } else {
-         std::vector<double> x2(data.NDim());
+         auto &x2 = buf.fX2;
          data.GetBinUpEdgeCoordinates(i, x2.data());
          // calculate normalized integral and gradient (divided by bin volume)
          // need to set function and parameters here in case loop is parallelized
@@ -779,9 +820,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       std::cout << "\tfval = " << fval << std::endl;
 #endif
       if (!CheckInfNaNValue(fval)) {
-         isPointRejected[i] = true;
-         // Return a zero contribution to all partial derivatives on behalf of the current point
-         return pointContribution;
+         // No contribution to any partial derivative on behalf of the current point
+         return false;
       }
 
       // loop on the parameters
@@ -800,30 +840,25 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
          }
 
          // calculate derivative point contribution
-         pointContribution[ipar] = -2.0 * (y - fval) * invError * invError * gradFunc[ipar];
-      }
-
-      if (ipar < npar) {
-         // case loop was broken for an overflow in the gradient calculation
-         isPointRejected[i] = true;
+         pointContribution[ipar] += -2.0 * (y - fval) * invError * invError * gradFunc[ipar];
       }
 
-      return pointContribution;
+      // case loop was broken for an overflow in the gradient calculation
+      return ipar == npar;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
+   // sum the gradient over a contiguous range of points; the last element counts the rejected points
+   auto chunkFunction = [&](unsigned int begin, unsigned int end) {
+      PointBuffers buf(data.NDim(), npar);
+      std::vector<double> chunkGrad(npar + 1);
+      for (unsigned int i = begin; i < end; ++i) {
+         if (!mapFunction(i, buf, chunkGrad.data()))
+            chunkGrad[npar] += 1;
       }
-
-      return result;
+      return chunkGrad;
    };
 
-   std::vector<double> g(npar);
+   std::vector<double> g(npar + 1);
 
 #ifndef R__USE_IMT
    // If IMT is disabled, force the execution policy to the serial case
@@ -835,17 +870,11 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 #endif
 
    if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      g = chunkFunction(0, initialNPoints);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = MapReduceChunks<std::vector<double>>(initialNPoints, nChunks, chunkFunction);
    }
 #endif
    // else if(executionPolicy == ROOT::Fit::kMultiprocess){
@@ -865,8 +894,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    // correct the number of points
    nPoints = initialNPoints;
 
-   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](bool point) { return point; })) {
-      unsigned nRejected = std::accumulate(isPointRejected.begin(), isPointRejected.end(), 0);
+   unsigned nRejected = g[npar];
+   if (nRejected > 0) {
       assert(nRejected <= initialNPoints);
       nPoints = initialNPoints - nRejected;
 
@@ -876,7 +905,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    }
 
    // copy result
-   std::copy(g.begin(), g.end(), grad);
+   std::copy(g.begin(), g.begin() + npar, grad);
 }
 
 //______________________________________________________________________________________________________
@@ -1493,12 +1522,12 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
    IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
 #endif
 
-   auto mapFunction = [&](const unsigned i) {
+   auto mapFunction = [&](const unsigned i, PointBuffers &buf) {
       auto x1 = data.GetCoordComponent(i, 0);
       auto y = *data.ValuePtr(i);
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      auto &xc = buf.fXc;
       double fval = 0;
       double binVolume = 1.0;
 
@@ -1534,7 +1563,7 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         auto &x2 = buf.fX2;
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
       }
@@ -1605,11 +1634,16 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       return nloglike;
    };
 
-#ifdef R__USE_IMT
-   auto redFunction = [](const std::vector<double> &objs) {
-      return std::accumulate(objs.begin(), objs.end(), double{});
+   // evaluate a contiguous range of points, reusing the same buffers
+   auto chunkFunction = [&](unsigned int begin, unsigned int end) {
+      PointBuffers buf(data.NDim());
+      double chunkLogL{};
+      for (unsigned int i = begin; i < end; ++i)
+         chunkLogL += mapFunction(i, buf);
+      return chunkLogL;
    };
-#else
+
+#ifndef R__USE_IMT
    (void)nChunks;
 
    // If IMT is disabled, force the execution policy to the serial case
@@ -1622,14 +1656,10 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 
    double res{};
    if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      for (unsigned int i = 0; i < n; ++i) {
-         res += mapFunction(i);
-      }
+      res = chunkFunction(0, n);
 #ifdef R__USE_IMT
    } else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(data.Size());
-      res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+      res = MapReduceChunks<double>(n, nChunks, chunkFunction);
 #endif
       //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
       // ROOT::TProcessExecutor pool;
@@ -1679,10 +1709,9 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   auto mapFunction = [&](const unsigned int i) {
-      // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+   // add the contribution of point i to the gradient
+   auto mapFunction = [&](const unsigned int i, PointBuffers &buf, double *pointContribution) {
+      auto &gradFunc = buf.fGradFunc;
 
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
@@ -1693,7 +1722,7 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
+      auto &xc = buf.fXc;
 
       unsigned ndim = data.NDim();
       double binVolume = 1.0;
@@ -1728,7 +1757,7 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
+         auto &x2 = buf.fX2;
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
          CalculateGradientIntegral(func, x, x2.data(), p, &gradFunc[0]);
@@ -1756,7 +1785,7 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
          // df/dp * (1.  - y/f )
          if (fval > 0)
-            pointContribution[ipar] = gradFunc[ipar] * (1. - y / fval);
+            pointContribution[ipar] += gradFunc[ipar] * (1. - y / fval);
          else if (gradFunc[ipar] != 0) {
             const double kdmax1 = std::sqrt(std::numeric_limits<double>::max());
             const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
@@ -1765,24 +1794,18 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
                gg = std::min(gg, kdmax2);
             else
                gg = std::max(gg, -kdmax2);
-            pointContribution[ipar] = -gg;
+            pointContribution[ipar] -= gg;
          }
       }
-
-
-      return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
+   // sum the gradient over a contiguous range of points
+   auto chunkFunction = [&](unsigned int begin, unsigned int end) {
+      PointBuffers buf(data.NDim(), npar);
+      std::vector<double> chunkGrad(npar);
+      for (unsigned int i = begin; i < end; ++i)
+         mapFunction(i, buf, chunkGrad.data());
+      return chunkGrad;
    };
 
    std::vector<double> g(npar);
@@ -1798,17 +1821,11 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 #endif
 
    if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      g = chunkFunction(0, initialNPoints);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = MapReduceChunks<std::vector<double>>(initialNPoints, nChunks, chunkFunction);
    }
 #endif
 
@@ -511,6 +511,52 @@ TYPED_TEST(PoissonLikelihoodGradientTest, PoissonLikelihoodGradient)
    }
 }
 
+#ifdef R__USE_IMT
+// The multithreaded evaluation splits the bins in contiguous chunks: the results must not depend on their number.
+TEST(FitUtilChunks, BinnedEvaluation)
+{
+   TF2 f("fchunks", "[0]*exp(-0.5*((x-[1])/[2])^2-0.5*((y-[3])/[4])^2)", -5, 5, -5, 5);
+   f.SetParameters(100, 0, 1, 0.5, 2);
+   TH2D h("hchunks", "", 50, -5, 5, 40, -5, 5);
+   gRandom->SetSeed(111);
+   h.FillRandom("fchunks", 20000);
+   f.SetParameters(90, 0.1, 1.1, 0.4, 2.1);
+
+   ROOT::Fit::BinData data;
+   ROOT::Fit::FillData(data, &h);
+   ROOT::Math::WrappedMultiTF1 func(f, 2);
+   const double *p = f.GetParameters();
+   const unsigned int npar = f.GetNpar();
+
+   unsigned int nPoints = 0;
+   const double chi2 = ROOT::Fit::FitUtil::EvaluateChi2(func, data, p, nPoints, ROOT::EExecutionPolicy::kSequential);
+   const double logL = ROOT::Fit::FitUtil::EvaluatePoissonLogL(func, data, p, 0, true, nPoints,
+                                                               ROOT::EExecutionPolicy::kSequential);
+   std::vector<double> chi2Grad(npar), logLGrad(npar);
+   ROOT::Fit::FitUtil::EvaluateChi2Gradient(func, data, p, chi2Grad.data(), nPoints,
+                                            ROOT::EExecutionPolicy::kSequential);
+   ROOT::Fit::FitUtil::EvaluatePoissonLogLGradient(func, data, p, logLGrad.data(), nPoints,
+                                                   ROOT::EExecutionPolicy::kSequential);
+   EXPECT_EQ(nPoints, data.Size());
+
+   for (unsigned int nChunks : {0u, 1u, 7u, data.Size() + 5}) {
+      const auto mt = ROOT::EExecutionPolicy::kMultiThread;
+      unsigned int n = 0;
+      EXPECT_NEAR(ROOT::Fit::FitUtil::EvaluateChi2(func, data, p, n, mt, nChunks), chi2, 1e-10 * chi2);
+      EXPECT_NEAR(ROOT::Fit::FitUtil::EvaluatePoissonLogL(func, data, p, 0, true, n, mt, nChunks), logL,
+                  1e-10 * std::abs(logL));
+      std::vector<double> grad(npar);
+      ROOT::Fit::FitUtil::EvaluateChi2Gradient(func, data, p, grad.data(), n, mt, nChunks);
+      EXPECT_EQ(n, data.Size());
+      for (unsigned int i = 0; i < npar; ++i)
+         EXPECT_NEAR(grad[i], chi2Grad[i], 1e-8 * std::abs(chi2Grad[i]) + 1e-10);
+      ROOT::Fit::FitUtil::EvaluatePoissonLogLGradient(func, data, p, grad.data(), n, mt, nChunks);
+      for (unsigned int i = 0; i < npar; ++i)
+         EXPECT_NEAR(grad[i], logLGrad[i], 1e-8 * std::abs(logLGrad[i]) + 1e-10);
+   }
+}
+#endif
+
 // add main() to avoid a linking error
 int main(int argc, char **argv)
 {
@@ -75,6 +75,10 @@ endif()
 add_library(Minuit2Common INTERFACE)
 add_library(Minuit2::Common ALIAS Minuit2Common)
 
+# Threads for the MnThreadExecutor
+find_package(Threads REQUIRED)
+target_link_libraries(Minuit2Common INTERFACE Threads::Threads)
+
 # OpenMP support
 if(minuit2_omp)
     if(CMAKE_PROJECT_NAME STREQUAL PROJECT_NAME)
@@ -83,6 +87,15 @@ if(minuit2_omp)
     target_link_libraries(Minuit2Common INTERFACE OpenMP::OpenMP_CXX)
 endif()
 
+# BLAS and LAPACK support
+if(minuit2_blas)
+    if(CMAKE_PROJECT_NAME STREQUAL PROJECT_NAME)
+        message(STATUS "Building Minuit2 with BLAS and LAPACK support")
+    endif()
+    target_compile_definitions(Minuit2Common INTERFACE MN_USE_BLAS)
+    target_link_libraries(Minuit2Common INTERFACE ${LAPACK_LIBRARIES} ${BLAS_LIBRARIES})
+endif()
+
 # MPI support
 # Uses the old CXX bindings (deprecated), probably do not activate
 if(minuit2_mpi)
@@ -167,6 +180,7 @@ endif()
 # Setup package info
 add_feature_info(minuit2_omp minuit2_omp "OpenMP (Thread safe FCNs only)")
 add_feature_info(minuit2_mpi minuit2_mpi "MPI (Thread safe FCNs only)")
+add_feature_info(minuit2_blas minuit2_blas "BLAS and LAPACK for the linear algebra")
 set_package_properties(OpenMP PROPERTIES
     URL "http://www.openmp.org"
     DESCRIPTION "Parallel compiler directives"
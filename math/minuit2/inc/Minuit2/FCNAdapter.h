@@ -43,6 +43,11 @@ public:
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+
+   /// declare that the function can be called concurrently from several threads
+   void SetThreadSafe(bool on) { fThreadSafe = on; }
+
    // virtual std::vector<double> Gradient(const std::vector<double>&) const;
 
    // forward interface
@@ -51,6 +56,7 @@ public:
 private:
    const Function &fFunc;
    double fUp;
+   bool fThreadSafe = false;
 };
 
 } // end namespace Minuit2
@@ -104,6 +104,14 @@ public:
        Re-implement this function if needed.
    */
    virtual void SetErrorDef(double){};
+
+   /**
+       Return true if the function can be called concurrently from several threads with
+       different parameter vectors. Only then MnHesse and MnMinos distribute their function
+       calls to the executor of the MnStrategy (see MnStrategy::SetExecutor).
+       Re-implement this function if the function is thread safe; the default is false.
+   */
+   virtual bool IsThreadSafe() const { return false; }
 };
 
 } // namespace Minuit2
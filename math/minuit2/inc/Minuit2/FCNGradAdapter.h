@@ -13,6 +13,7 @@
 #include "Minuit2/FCNGradientBase.h"
 #include "Minuit2/MnPrint.h"
 
+#include <atomic>
 #include <vector>
 #include <functional>
 
@@ -35,7 +36,7 @@ template <class Function>
 class FCNGradAdapter : public FCNGradientBase {
 
 public:
-   FCNGradAdapter(const Function &f, double up = 1.) : fFunc(f), fUp(up), fGrad(std::vector<double>(fFunc.NDim())) {}
+   FCNGradAdapter(const Function &f, double up = 1.) : fFunc(f), fUp(up) {}
 
    ~FCNGradAdapter() override {}
 
@@ -44,16 +45,19 @@ public:
 
    double Up() const override { return fUp; }
 
+   // the gradient is filled in a new vector for each call, such that calls from different threads do not interfere
    std::vector<double> Gradient(const std::vector<double> &v) const override
    {
-      fFunc.Gradient(&v[0], &fGrad[0]);
-      return fGrad;
+      std::vector<double> grad(fFunc.NDim());
+      fFunc.Gradient(&v[0], grad.data());
+      return grad;
    }
    std::vector<double> GradientWithPrevResult(const std::vector<double> &v, double *previous_grad, double *previous_g2,
                                               double *previous_gstep) const override
    {
-      fFunc.GradientWithPrevResult(&v[0], &fGrad[0], previous_grad, previous_g2, previous_gstep);
-      return fGrad;
+      std::vector<double> grad(fFunc.NDim());
+      fFunc.GradientWithPrevResult(&v[0], grad.data(), previous_grad, previous_g2, previous_gstep);
+      return grad;
    }
    // forward interface
    // virtual double operator()(int npar, double* params,int iflag = 4) const;
@@ -71,64 +75,64 @@ public:
    std::vector<double> G2(const std::vector<double> & x) const override {
       if (fG2Func)
          return fG2Func(x);
-      if (fHessianFunc) {
-         unsigned int n = fFunc.NDim();
-         if (fG2Vec.empty() ) fG2Vec.resize(n);
-         if (fHessian.empty() ) fHessian.resize(n*n);
-         fHessianFunc(x,fHessian.data());
-         if (!fHessian.empty()) {
-            // get diagonal element of h
-            for (unsigned int i = 0; i < n; i++)
-               fG2Vec[i] = fHessian[i*n+i];
-         }
-         else fG2Vec.clear();
-      }
-      else
-         if (!fG2Vec.empty()) fG2Vec.clear();
-      return fG2Vec;
+      std::vector<double> hessian = Hessian(x);
+      if (hessian.empty())
+         return hessian;
+      // get diagonal element of h
+      unsigned int n = fFunc.NDim();
+      std::vector<double> g2(n);
+      for (unsigned int i = 0; i < n; i++)
+         g2[i] = hessian[i*n+i];
+      return g2;
    }
 
-   /// compute Hessian. Return Hessian as a std::vector of size(n*n)
+   /// compute Hessian. Return Hessian as a std::vector of size(n*n), or an empty vector if it can't be computed.
+   /// Like the gradient, it is filled in a new vector for each call.
    std::vector<double> Hessian(const std::vector<double> & x ) const override {
+      if (!HasHessian())
+         return {};
       unsigned int n = fFunc.NDim();
-      if (fHessianFunc) {
-         if (fHessian.empty() ) fHessian.resize(n * n);
-         bool ret = fHessianFunc(x,fHessian.data());
-         if (!ret) {
-            fHessian.clear();
-            fHessianFunc = nullptr;
-         }
-      } else {
-         fHessian.clear();
+      std::vector<double> hessian(n * n);
+      if (!fHessianFunc(x,hessian.data())) {
+         // the function has no Hessian, don't try again
+         fHessianFailed = true;
+         return {};
       }
-
-      return fHessian;
+      return hessian;
    }
 
    bool HasG2() const override {
       return bool(fG2Func);
    }
    bool HasHessian() const override {
-      return bool(fHessianFunc);
+      return fHessianFunc && !fHessianFailed;
    }
 
    template<class Func>
    void SetG2Function(Func f) { fG2Func = f;}
 
    template<class Func>
-   void SetHessianFunction(Func f) { fHessianFunc = f;}
+   void SetHessianFunction(Func f)
+   {
+      fHessianFunc = f;
+      fHessianFailed = false;
+   }
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+
+   /// declare that the function and its gradient can be called concurrently from several threads
+   void SetThreadSafe(bool on) { fThreadSafe = on; }
+
 private:
    const Function &fFunc;
    double fUp;
-   mutable std::vector<double> fGrad;
-   mutable std::vector<double> fHessian;
-   mutable std::vector<double> fG2Vec;
+   bool fThreadSafe = false;
+   mutable std::atomic<bool> fHessianFailed{false};
 
    std::function<std::vector<double>(const std::vector<double> &)> fG2Func;
-   mutable std::function<bool(const std::vector<double> &, double *)> fHessianFunc;
+   std::function<bool(const std::vector<double> &, double *)> fHessianFunc;
 };
 
 } // end namespace Minuit2
@@ -30,7 +30,7 @@ public:
 
    ~MnEigen() {}
 
-   /// calculate the eigenvalues
+   /// calculate the eigenvalues in ascending order. They are NaN if the calculation does not converge.
    std::vector<double> operator()(const MnUserCovariance &) const;
 
 private:
@@ -0,0 +1,73 @@
+// @(#)root/minuit2:$Id$
+// Authors: M. Winkler, F. James, L. Moneta, A. Zsenei   2003-2005
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_MnExecutor
+#define ROOT_Minuit2_MnExecutor
+
+#include "Minuit2/MnConfig.h"
+
+#include <functional>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/**
+   Interface for running independent tasks of MnHesse (the elements of the Hessian)
+   and MnMinos (the crossings of the different parameters and directions) concurrently.
+   An executor is set in the MnStrategy, and it is only used if the FCN declares itself
+   thread safe with FCNBase::IsThreadSafe(). Users can implement DoForeach() to run
+   the tasks in their own thread pool; MnThreadExecutor is the default implementation.
+   Concurrent tasks need Minuit2 to be built without MN_USE_STACK_ALLOC (the default),
+   see StackAllocator.h.
+ */
+
+class MnExecutor {
+
+public:
+   virtual ~MnExecutor() {}
+
+   /// call task(i) for all i in [0, n) and return when all calls are done;
+   /// the calls can run concurrently and in any order, with the print level of the calling thread
+   /// (see MnPrint::GlobalLevel)
+   void Foreach(unsigned int n, const std::function<void(unsigned int)> &task) const;
+
+   /// maximum number of tasks that run concurrently
+   virtual unsigned int NWorkers() const = 0;
+
+private:
+   /// implementation of Foreach, must be implemented by the derived classes
+   virtual void DoForeach(unsigned int n, const std::function<void(unsigned int)> &task) const = 0;
+};
+
+/**
+   Executor that runs the tasks on std::threads, which are started for each call of Foreach().
+   The calling thread takes part in the work. If a task throws, the first exception is
+   rethrown in the calling thread after all threads are joined.
+ */
+
+class MnThreadExecutor : public MnExecutor {
+
+public:
+   /// number of threads including the calling thread; 0 means std::thread::hardware_concurrency()
+   explicit MnThreadExecutor(unsigned int nthreads = 0);
+
+   unsigned int NWorkers() const override { return fNThreads; }
+
+private:
+   void DoForeach(unsigned int n, const std::function<void(unsigned int)> &task) const override;
+
+   unsigned int fNThreads;
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_MnExecutor
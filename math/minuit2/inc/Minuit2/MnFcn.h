@@ -13,6 +13,8 @@
 #include "Minuit2/MnConfig.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <atomic>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -50,7 +52,8 @@ private:
    const FCNBase &fFCN;
 
 protected:
-   mutable int fNumCall;
+   // atomic since MnHesse can call the function concurrently, see FCNBase::IsThreadSafe()
+   mutable std::atomic<int> fNumCall;
 };
 
 } // namespace Minuit2
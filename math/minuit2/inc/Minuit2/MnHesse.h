@@ -11,6 +11,7 @@
 #define ROOT_Minuit2_MnHesse
 
 #include "Minuit2/MnConfig.h"
+#include "Minuit2/MnMatrixfwd.h"
 #include "Minuit2/MnStrategy.h"
 
 #include <vector>
@@ -29,6 +30,7 @@ class MnMachinePrecision;
 class MnFcn;
 class FunctionMinimum;
 class FCNGradientBase;
+class AnalyticalGradientCalculator;
 
 //_______________________________________________________________________
 /**
@@ -96,7 +98,15 @@ private:
    MinimumState ComputeNumerical(const MnFcn &, const MinimumState &, const MnUserTransformation &, unsigned int maxcalls) const;
 
    /// internal function to compute the Hessian using an analytical computation or externally provided in the FCNGradientBase class
-   MinimumState ComputeAnalytical(const FCNGradientBase &, const MinimumState &, const MnUserTransformation &) const;
+   MinimumState ComputeAnalytical(const FCNGradientBase &, const MinimumState &, const MnUserTransformation &,
+                                  unsigned int maxcalls) const;
+
+   /// internal function to compute the Hessian with finite differences of the gradient provided by the FCNGradientBase class
+   bool HessianFromGradient(const AnalyticalGradientCalculator &, const MinimumState &, const MnUserTransformation &,
+                            MnAlgebraicSymMatrix &) const;
+
+   /// whether the Hessian of the FCN can be computed from its gradient or Hessian instead of numerically
+   bool UseAnalytical(const FCNGradientBase &) const;
 
    MnStrategy fStrategy;
 };
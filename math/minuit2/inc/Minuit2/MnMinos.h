@@ -13,6 +13,7 @@
 #include "Minuit2/MnStrategy.h"
 
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 
@@ -22,6 +23,7 @@ class FCNBase;
 class FunctionMinimum;
 class MinosError;
 class MnCross;
+class MnExecutor;
 
 //__________________________________________________________________
 /**
@@ -57,10 +59,18 @@ public:
    /// can be printed via std::cout
    MinosError Minos(unsigned int, unsigned int maxcalls = 0, double toler = 0.1) const;
 
+   /// ask for the MinosError of several parameters; if the strategy has an executor and the FCN
+   /// is thread safe, all the crossings are searched concurrently
+   std::vector<MinosError>
+   Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls = 0, double toler = 0.1) const;
+
 protected:
    /// internal method to get crossing value via MnFunctionCross
    MnCross FindCrossValue(int dir, unsigned int, unsigned int maxcalls, double toler) const;
 
+   /// executor of the strategy if it can be used with the FCN, else nullptr
+   const MnExecutor *Executor() const;
+
 private:
    const FCNBase &fFCN;
    const FunctionMinimum &fMinimum;
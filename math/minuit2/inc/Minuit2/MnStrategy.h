@@ -10,10 +10,14 @@
 #ifndef ROOT_Minuit2_MnStrategy
 #define ROOT_Minuit2_MnStrategy
 
+#include <memory>
+
 namespace ROOT {
 
 namespace Minuit2 {
 
+class MnExecutor;
+
 //_________________________________________________________________________
 /**
     API class for defining four levels of strategies: low (0), medium (1),
@@ -47,9 +51,12 @@ public:
    unsigned int HessianGradientNCycles() const { return fHessGradNCyc; }
    unsigned int HessianCentralFDMixedDerivatives() const { return fHessCFDG2; }
    unsigned int HessianForcePosDef() const { return fHessForcePosDef; }
+   unsigned int HessianFromGradient() const { return fHessFromGrad; }
 
    int StorageLevel() const { return fStoreLevel; }
 
+   const std::shared_ptr<const MnExecutor> &Executor() const { return fExecutor; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy == 2; }
@@ -77,10 +84,20 @@ public:
    // 0 = do not force matrix positive definite
    void SetHessianForcePosDef(unsigned int flag) { fHessForcePosDef = flag; }
 
+   // 1 = if the FCN provides the gradient but not the Hessian, compute the Hessian with central finite differences
+   //     of the gradient (2n gradient evaluations, suited for exact gradients e.g. from automatic differentiation)
+   // 0 = compute the Hessian with finite differences of the function values (default)
+   void SetHessianFromGradient(unsigned int flag) { fHessFromGrad = flag; }
+
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // set the executor that MnHesse and MnMinos use to run their function calls concurrently,
+   // e.g. an MnThreadExecutor; this is only done if the FCN is thread safe (see FCNBase::IsThreadSafe)
+   // nullptr = run all function calls in the calling thread (default)
+   void SetExecutor(std::shared_ptr<const MnExecutor> executor) { fExecutor = std::move(executor); }
+
 private:
    unsigned int fStrategy;
 
@@ -93,7 +110,9 @@ private:
    unsigned int fHessGradNCyc;
    int fHessCFDG2;
    int fHessForcePosDef;
+   int fHessFromGrad;
    int fStoreLevel;
+   std::shared_ptr<const MnExecutor> fExecutor;
 };
 
 } // namespace Minuit2
@@ -9,6 +9,12 @@
 
 #include "Minuit2/LAVector.h"
 #include "Minuit2/LASymMatrix.h"
+#include "Minuit2/MnPrint.h"
+
+#include <limits>
+
+// with MN_USE_BLAS this is implemented in mnblas.cxx
+#ifndef MN_USE_BLAS
 
 namespace ROOT {
 
@@ -18,7 +24,8 @@ int mneigen(double *, unsigned int, unsigned int, unsigned int, double *, double
 
 LAVector eigenvalues(const LASymMatrix &mat)
 {
-   // calculate eigenvalues of symmetric matrices using mneigen function (translate from fortran Minuit)
+   // calculate eigenvalues of symmetric matrices using mneigen function (translate from fortran Minuit).
+   // If the iterations don't converge, the eigenvalues are NaN.
    unsigned int nrow = mat.Nrow();
 
    LAVector tmp(nrow * nrow);
@@ -31,10 +38,15 @@ LAVector eigenvalues(const LASymMatrix &mat)
       }
 
    int info = mneigen(tmp.Data(), nrow, nrow, work.size(), work.Data(), 1.e-6);
-   (void)info;
-   assert(info == 0);
 
    LAVector result(nrow);
+   if (info != 0) {
+      MnPrint print("eigenvalues");
+      print.Error("Calculation of the eigenvalues does not converge");
+      for (unsigned int i = 0; i < nrow; i++)
+         result(i) = std::numeric_limits<double>::quiet_NaN();
+      return result;
+   }
    for (unsigned int i = 0; i < nrow; i++)
       result(i) = work(i);
 
@@ -44,3 +56,5 @@ LAVector eigenvalues(const LASymMatrix &mat)
 } // namespace Minuit2
 
 } // namespace ROOT
+
+#endif // MN_USE_BLAS
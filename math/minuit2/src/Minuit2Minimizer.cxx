@@ -25,6 +25,7 @@
 #include "Minuit2/MnMinos.h"
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnHesse.h"
+#include "Minuit2/MnExecutor.h"
 #include "Minuit2/MinuitParameter.h"
 #include "Minuit2/MnUserFcn.h"
 #include "Minuit2/MnPrint.h"
@@ -384,8 +385,16 @@ void Minuit2Minimizer::SetFunction(const ROOT::Math::IMultiGenFunction &func)
    fDim = func.NDim();
    const bool hasGrad = func.HasGradient();
    if (!fUseFumili) {
-      fMinuitFCN = hasGrad ? static_cast<ROOT::Minuit2::FCNBase *>(new ROOT::Minuit2::FCNGradAdapter<ROOT::Math::IMultiGradFunction>(dynamic_cast<ROOT::Math::IMultiGradFunction const&>(func), ErrorDef()))
-                           : static_cast<ROOT::Minuit2::FCNBase *>(new ROOT::Minuit2::FCNAdapter<ROOT::Math::IMultiGenFunction>(func, ErrorDef()));
+      // the function calls of Hesse and Minos can only run concurrently if the function declares itself thread safe
+      if (hasGrad) {
+         auto adapter = new ROOT::Minuit2::FCNGradAdapter<ROOT::Math::IMultiGradFunction>(dynamic_cast<ROOT::Math::IMultiGradFunction const&>(func), ErrorDef());
+         adapter->SetThreadSafe(func.IsThreadSafe());
+         fMinuitFCN = adapter;
+      } else {
+         auto adapter = new ROOT::Minuit2::FCNAdapter<ROOT::Math::IMultiGenFunction>(func, ErrorDef());
+         adapter->SetThreadSafe(func.IsThreadSafe());
+         fMinuitFCN = adapter;
+      }
    } else {
       if(hasGrad) {
          // for Fumili the fit method function interface is required
@@ -444,6 +453,13 @@ ROOT::Minuit2::MnStrategy customizedStrategy(unsigned int strategyLevel, ROOT::M
    st.SetGradientStepTolerance(customize("GradientStepTolerance", st.GradientStepTolerance()));
    st.SetHessianStepTolerance(customize("HessianStepTolerance", st.HessianStepTolerance()));
    st.SetHessianG2Tolerance(customize("HessianG2Tolerance", st.HessianG2Tolerance()));
+   st.SetHessianFromGradient(customize("HessianFromGradient", int(st.HessianFromGradient())));
+
+   // run the function calls of Hesse and Minos on this number of threads (0 = all cores);
+   // this is only done if the function is thread safe (see IBaseFunctionMultiDim::IsThreadSafe)
+   const int nThreads = customize("NThreads", 1);
+   if (nThreads != 1)
+      st.SetExecutor(std::make_shared<ROOT::Minuit2::MnThreadExecutor>(std::max(nThreads, 0)));
 
    return st;
 }
@@ -931,7 +947,10 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
+   // Minos uses the default strategy, only the executor is taken from the options
+   ROOT::Minuit2::MnStrategy minosStrategy{1};
+   minosStrategy.SetExecutor(customizedStrategy(Strategy(), fOptions).Executor());
+   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum, minosStrategy);
 
    // run MnCross
    MnCross low;
@@ -960,7 +979,6 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
          std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER error for parameter #" << i << " : "
                    << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
       }
-      low = minos.Loval(i, maxfcn, tol);
    }
    if (runUpper) {
       if (debugLevel >= 1) {
@@ -969,10 +987,19 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
          std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS UPPER error for parameter #" << i << " : "
                    << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
       }
-      up = minos.Upval(i, maxfcn, tol);
    }
 
-   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
+   ROOT::Minuit2::MinosError me;
+   if (runLower && runUpper) {
+      // the lower and upper crossings run concurrently if the strategy has an executor
+      me = minos.Minos(i, maxfcn, tol);
+   } else {
+      if (runLower)
+         low = minos.Loval(i, maxfcn, tol);
+      if (runUpper)
+         up = minos.Upval(i, maxfcn, tol);
+      me = ROOT::Minuit2::MinosError(i, fMinimum->UserState().Value(i), low, up);
+   }
 
    // restore global print level
    if (prev_level > -2)
@@ -1222,7 +1249,8 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(customizedStrategy(Strategy(), fOptions));
+   const ROOT::Minuit2::MnStrategy strategy = customizedStrategy(Strategy(), fOptions);
+   ROOT::Minuit2::MnHesse hesse(strategy);
 
    // case when function minimum exists
    if (fMinimum) {
@@ -0,0 +1,81 @@
+// @(#)root/minuit2:$Id$
+// Authors: M. Winkler, F. James, L. Moneta, A. Zsenei   2003-2005
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/MnExecutor.h"
+#include "Minuit2/MnPrint.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+void MnExecutor::Foreach(unsigned int n, const std::function<void(unsigned int)> &task) const
+{
+   // the global print level is thread local, the tasks take the one of the calling thread
+   const int printLevel = MnPrint::GlobalLevel();
+   struct PrintLevelGuard {
+      int fPrevLevel;
+      ~PrintLevelGuard() { MnPrint::SetGlobalLevel(fPrevLevel); }
+   };
+
+   DoForeach(n, [&](unsigned int i) {
+      PrintLevelGuard guard{MnPrint::SetGlobalLevel(printLevel)};
+      task(i);
+   });
+}
+
+MnThreadExecutor::MnThreadExecutor(unsigned int nthreads) : fNThreads(nthreads)
+{
+   if (fNThreads == 0)
+      fNThreads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+void MnThreadExecutor::DoForeach(unsigned int n, const std::function<void(unsigned int)> &task) const
+{
+   // the tasks are taken one by one from a shared counter, since their run time can be very
+   // different (e.g. the Minos crossings)
+   std::atomic<unsigned int> next{0};
+   std::exception_ptr error;
+   std::mutex errorMutex;
+
+   auto work = [&]() {
+      for (unsigned int i = next++; i < n; i = next++) {
+         try {
+            task(i);
+         } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+               error = std::current_exception();
+            // skip the tasks that were not started yet
+            next = n;
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   const unsigned int nthreads = std::min(fNThreads, n);
+   for (unsigned int i = 1; i < nthreads; i++)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+
+   if (error)
+      std::rethrow_exception(error);
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
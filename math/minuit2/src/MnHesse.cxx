@@ -22,8 +22,13 @@
 #include "Minuit2/VariableMetricEDMEstimator.h"
 #include "Minuit2/FunctionMinimum.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnExecutor.h"
 #include "Minuit2/MPIProcess.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -76,10 +81,10 @@ MnHesse::operator()(const FCNBase &fcn, const MnUserParameterState &state, unsig
    MinimumParameters par(x, amin);
    // check if we can use analytical gradient
    auto * gradFCN = dynamic_cast<const FCNGradientBase *>(&(fcn));
-   if (gradFCN) {
+   if (gradFCN && UseAnalytical(*gradFCN)) {
       // no need to compute gradient here
       MinimumState tmp = ComputeAnalytical(*gradFCN, MinimumState(par, MinimumError(MnAlgebraicSymMatrix(n), 1.), FunctionGradient(n),
-        state.Edm(), state.NFcn()), state.Trafo());
+        state.Edm(), state.NFcn()), state.Trafo(), maxcalls);
       return MnUserParameterState(tmp, fcn.Up(), state.Trafo());
    }
    // case of numerical gradient
@@ -103,18 +108,74 @@ void MnHesse::operator()(const FCNBase &fcn, FunctionMinimum &min, unsigned int
 MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, const MnUserTransformation &trafo,
                                  unsigned int maxcalls) const
 {
-   // check first if we have an analytical gradient
-   if (st.Gradient().IsAnalytical()) {
+   // check first if we have an analytical gradient, or if the Hessian is requested from the gradient of the FCN.
+   // The gradient of the state is numerical if the minimizer computed the last Hessian itself.
+   auto * gradFCN = dynamic_cast<const FCNGradientBase *>(&(mfcn.Fcn()));
+   if (gradFCN && (st.Gradient().IsAnalytical() || fStrategy.HessianFromGradient())) {
       // check if we can compute analytical Hessian
-      auto * gradFCN = dynamic_cast<const FCNGradientBase *>(&(mfcn.Fcn()));
-      if (gradFCN && gradFCN->HasHessian()) {
-         return ComputeAnalytical(*gradFCN, st, trafo);
+      if (UseAnalytical(*gradFCN)) {
+         return ComputeAnalytical(*gradFCN, st, trafo, maxcalls);
       }
    }
    // case of numerical computation or only analytical first derivatives
    return ComputeNumerical(mfcn, st, trafo, maxcalls);
 }
-MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const MinimumState &st, const MnUserTransformation &trafo) const
+
+bool MnHesse::UseAnalytical(const FCNGradientBase &fcn) const
+{
+   return fcn.HasHessian() || fStrategy.HessianFromGradient();
+}
+
+bool MnHesse::HessianFromGradient(const AnalyticalGradientCalculator &gc, const MinimumState &st,
+                                  const MnUserTransformation &trafo, MnAlgebraicSymMatrix &hmat) const
+{
+   // compute the Hessian with central differences of the gradient: H(i,j) = (g_j(x + d_i) - g_j(x - d_i)) / 2 d_i.
+   // This needs 2n gradient evaluations instead of the O(n^2) function evaluations of ComputeNumerical.
+   MnPrint print("MnHesse");
+
+   const MnMachinePrecision &prec = trafo.Precision();
+   unsigned int n = st.Parameters().Vec().size();
+   MnAlgebraicVector x = st.Parameters().Vec();
+   const bool hasErrors = st.Error().IsAvailable();
+
+   // derivatives of the gradient, dg(i * n + j) = d g_j / d x_i
+   std::vector<double> dg(n * n);
+   for (unsigned int i = 0; i < n; i++) {
+      const double xtf = x(i);
+      // step of a fraction of the current error estimate, or relative to the parameter value if there is none
+      double d = hasErrors && st.Error().InvHessian()(i, i) > 0. ? 0.1 * std::sqrt(st.Error().InvHessian()(i, i))
+                                                                    : std::cbrt(prec.Eps()) * (std::fabs(xtf) + 1.);
+      d = std::max(d, 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2()));
+      // the internal coordinates of parameters with limits are periodic
+      if (trafo.Parameter(trafo.ExtOfInt(i)).HasLimits())
+         d = std::min(d, 0.5);
+
+      x(i) = xtf + d;
+      MnAlgebraicVector gPlus = gc(MinimumParameters(x, 0.)).Grad();
+      x(i) = xtf - d;
+      MnAlgebraicVector gMinus = gc(MinimumParameters(x, 0.)).Grad();
+      x(i) = xtf;
+
+      for (unsigned int j = 0; j < n; j++)
+         dg[i * n + j] = (gPlus(j) - gMinus(j)) / (2. * d);
+   }
+
+   // symmetrize
+   for (unsigned int i = 0; i < n; i++) {
+      for (unsigned int j = i; j < n; j++) {
+         hmat(i, j) = 0.5 * (dg[i * n + j] + dg[j * n + i]);
+         if (!std::isfinite(hmat(i, j))) {
+            print.Error("Non-finite second derivative for parameters", i, j);
+            return false;
+         }
+      }
+   }
+
+   print.Debug("Hessian from finite differences of the gradient", hmat);
+   return true;
+}
+MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const MinimumState &st, const MnUserTransformation &trafo,
+                                        unsigned int maxcalls) const
 {
    unsigned int n = st.Parameters().Vec().size();
    MnAlgebraicSymMatrix vhmat(n);
@@ -123,6 +184,24 @@ MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const Minim
 
    const MnMachinePrecision &prec = trafo.Precision();
 
+   // the Hessian from the gradient takes 2n gradient evaluations, which are counted as function calls
+   unsigned int nfcn = st.NFcn();
+   if (!fcn.HasHessian()) {
+      if (maxcalls == 0)
+         maxcalls = 200 + 100 * n + 5 * n * n;
+      if (nfcn + 2 * n > maxcalls) {
+         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+         const MnAlgebraicVector &g2 = st.Gradient().G2();
+         for (unsigned int j = 0; j < n; j++) {
+            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+         }
+         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
+                             st.Edm(), nfcn);
+      }
+      nfcn += 2 * n;
+   }
+
    std::unique_ptr<AnalyticalGradientCalculator> hc;
    if (fcn.gradParameterSpace() == GradientParameterSpace::Internal) {
       hc = std::unique_ptr<AnalyticalGradientCalculator> (new ExternalInternalGradientCalculator(fcn,trafo));
@@ -130,11 +209,11 @@ MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const Minim
       hc = std::make_unique<AnalyticalGradientCalculator>(fcn,trafo);
    }
 
-   bool ret = hc->Hessian(st.Parameters(), vhmat);
+   bool ret = fcn.HasHessian() ? hc->Hessian(st.Parameters(), vhmat) : HessianFromGradient(*hc, st, trafo, vhmat);
    if (!ret) {
       print.Error("Error computing analytical Hessian. MnHesse fails and will return a null matrix");
       return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             st.NFcn());
+                             nfcn);
    }
    MnAlgebraicVector g2(n);
    for (unsigned int i = 0; i < n; i++)
@@ -161,7 +240,7 @@ MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const Minim
          tmpsym(j,j) = 1. / g2(j);
       }
 
-      return MinimumState(st.Parameters(), MinimumError(tmpsym, MinimumError::MnInvertFailed), gr, st.Edm(), st.NFcn());
+      return MinimumState(st.Parameters(), MinimumError(tmpsym, MinimumError::MnInvertFailed), gr, st.Edm(), nfcn);
    }
 
    VariableMetricEDMEstimator estim;
@@ -170,7 +249,7 @@ MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const Minim
    if (tmpErr.IsMadePosDef()) {
       MinimumError err(vhmat, MinimumError::MnMadePosDef);
       double edm = estim.Estimate(gr, err);
-      return MinimumState(st.Parameters(), err, gr, edm, st.NFcn());
+      return MinimumState(st.Parameters(), err, gr, edm, nfcn);
    }
 
    // calculate edm for good errors
@@ -181,7 +260,7 @@ MinimumState MnHesse::ComputeAnalytical(const FCNGradientBase & fcn, const Minim
    print.Debug("Hessian is ACCURATE. New state:", "\n  First derivative:", st.Gradient().Grad(),
                 "\n  Covariance matrix:", vhmat, "\n  Edm:", edm);
 
-   return MinimumState(st.Parameters(), err, gr, edm, st.NFcn());
+   return MinimumState(st.Parameters(), err, gr, edm, nfcn);
 }
 
 
@@ -228,9 +307,14 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
+   // The tasks below only read x and write distinct elements of the vectors and the matrix, such that
+   // they can run concurrently if the FCN is thread safe
+   const MnExecutor *executor = mfcn.Fcn().IsThreadSafe() ? fStrategy.Executor().get() : nullptr;
 
-      double xtf = x(i);
+   // second derivative of parameter i, returns false if it is zero
+   auto diagonal = [&](unsigned int i) {
+      MnAlgebraicVector xi = x;
+      double xtf = xi(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
       double d = std::fabs(gst(i));
       if (d < dmin)
@@ -243,21 +327,21 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          double fs1 = 0.;
          double fs2 = 0.;
          for (unsigned int multpy = 0; multpy < 5; multpy++) {
-            x(i) = xtf + d;
-            fs1 = mfcn(x);
-            x(i) = xtf - d;
-            fs2 = mfcn(x);
-            x(i) = xtf;
+            xi(i) = xtf + d;
+            fs1 = mfcn(xi);
+            xi(i) = xtf - d;
+            fs2 = mfcn(xi);
+            xi(i) = xtf;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
             print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
-               goto L30; // break
+               break;
             if (trafo.Parameter(i).HasLimits()) {
                if (d > 0.5)
-                  goto L26;
+                  break;
                d *= 10.;
                if (d > 0.5)
                   d = 0.51;
@@ -265,22 +349,9 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             }
             d *= 10.;
          }
+         if (sag == 0)
+            return false;
 
-      L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
-
-      L30:
          double g2bfor = g2(i);
          g2(i) = 2. * sag / (d * d);
          grd(i) = (fs1 - fs2) / (2. * d);
@@ -306,18 +377,50 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          d = std::max(d, 0.1 * dlast);
       }
       vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
+      return true;
+   };
 
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+   auto zeroSecondDerivative = [&](unsigned int i) {
+      print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                 "; MnHesse fails and will return diagonal matrix");
 
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
 
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
-                             st.Edm(), mfcn.NumOfCalls());
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
+                          mfcn.NumOfCalls());
+   };
+
+   auto callLimitReached = [&]() {
+      print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
+
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
+                          st.Edm(), mfcn.NumOfCalls());
+   };
+
+   if (executor) {
+      print.Debug("Compute the second derivatives with", executor->NWorkers(), "workers");
+      std::vector<char> ok(n);
+      executor->Foreach(n, [&](unsigned int i) { ok[i] = diagonal(i); });
+      for (unsigned int i = 0; i < n; i++) {
+         if (!ok[i])
+            return zeroSecondDerivative(i);
+      }
+      if (mfcn.NumOfCalls() > maxcalls)
+         return callLimitReached();
+   } else {
+      for (unsigned int i = 0; i < n; i++) {
+         if (!diagonal(i))
+            return zeroSecondDerivative(i);
+         if (mfcn.NumOfCalls() > maxcalls)
+            return callLimitReached();
       }
    }
 
@@ -335,7 +438,34 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    // off-diagonal Elements
    // initial starting values
    bool doCentralFD = fStrategy.HessianCentralFDMixedDerivatives();
-   if (n > 0) {
+   if (n > 0 && executor) {
+      // one task per element, each starting from the minimum
+      std::vector<std::pair<unsigned int, unsigned int>> elements;
+      elements.reserve(n * (n - 1) / 2);
+      for (unsigned int i = 0; i < n; i++) {
+         for (unsigned int j = i + 1; j < n; j++)
+            elements.emplace_back(i, j);
+      }
+      executor->Foreach(elements.size(), [&](unsigned int k) {
+         const unsigned int i = elements[k].first;
+         const unsigned int j = elements[k].second;
+         MnAlgebraicVector xij = x;
+         xij(i) += dirin(i);
+         xij(j) += dirin(j);
+         double fs1 = mfcn(xij);
+         if (!doCentralFD) {
+            vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+            return;
+         }
+         xij(i) -= 2. * dirin(i);
+         double fs3 = mfcn(xij);
+         xij(j) -= 2. * dirin(j);
+         double fs4 = mfcn(xij);
+         xij(i) += 2. * dirin(i);
+         double fs2 = mfcn(xij);
+         vhmat(i, j) = (fs1 - fs2 - fs3 + fs4) / (4. * dirin(i) * dirin(j));
+      });
+   } else if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
@@ -14,6 +14,7 @@
 #include "Minuit2/MnCross.h"
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnExecutor.h"
 
 namespace ROOT {
 
@@ -78,12 +79,22 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
 
    MnPrint print("MnMinos");
 
-   MnCross up = Upval(par, maxcalls, toler);
+   MnCross up;
+   MnCross lo;
+   if (const MnExecutor *executor = Executor()) {
+      // the two crossings are independent
+      executor->Foreach(2, [&](unsigned int i) {
+         if (i == 0)
+            up = Upval(par, maxcalls, toler);
+         else
+            lo = Loval(par, maxcalls, toler);
+      });
+   } else {
+      up = Upval(par, maxcalls, toler);
+      lo = Loval(par, maxcalls, toler);
+   }
 
    print.Debug("Function calls to find upper error", up.NFcn());
-
-   MnCross lo = Loval(par, maxcalls, toler);
-
    print.Debug("Function calls to find lower error", lo.NFcn());
 
    print.Debug("return Minos error", lo.Value(), ",", up.Value());
@@ -91,6 +102,35 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
    return MinosError(par, fMinimum.UserState().Value(par), lo, up);
 }
 
+std::vector<MinosError>
+MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis for several parameters, the crossings of the parameters and
+   // directions are independent of each other
+
+   std::vector<MnCross> crossings(2 * pars.size());
+   auto task = [&](unsigned int i) {
+      crossings[i] = i % 2 == 0 ? Upval(pars[i / 2], maxcalls, toler) : Loval(pars[i / 2], maxcalls, toler);
+   };
+   if (const MnExecutor *executor = Executor()) {
+      executor->Foreach(crossings.size(), task);
+   } else {
+      for (unsigned int i = 0; i < crossings.size(); i++)
+         task(i);
+   }
+
+   std::vector<MinosError> result;
+   result.reserve(pars.size());
+   for (unsigned int i = 0; i < pars.size(); i++)
+      result.emplace_back(pars[i], fMinimum.UserState().Value(pars[i]), crossings[2 * i + 1], crossings[2 * i]);
+   return result;
+}
+
+const MnExecutor *MnMinos::Executor() const
+{
+   return fFCN.IsThreadSafe() ? fStrategy.Executor().get() : nullptr;
+}
+
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
 {
    // get crossing value in the parameter direction :
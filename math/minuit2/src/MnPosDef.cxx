@@ -13,6 +13,7 @@
 #include "Minuit2/MnPrint.h"
 
 #include <algorithm>
+#include <cmath>
 
 namespace ROOT {
 
@@ -80,6 +81,10 @@ MinimumError MnPosDef::operator()(const MinimumError &e, const MnMachinePrecisio
    MnAlgebraicVector eval = eigenvalues(p);
    double pmin = eval(0);
    double pmax = eval(eval.size() - 1);
+   if (!std::isfinite(pmin) || !std::isfinite(pmax)) {
+      print.Warn("Eigenvalues of the error matrix can't be computed, it is not made pos-def");
+      return MinimumError(err, MinimumError::MnNotPosDef);
+   }
    // std::cout<<"pmin= "<<pmin<<" pmax= "<<pmax<<std::endl;
    pmax = std::max(std::fabs(pmax), 1.);
    if (pmin > epspdf * pmax)
@@ -0,0 +1,153 @@
+// @(#)root/minuit2:$Id$
+// Authors: M. Winkler, F. James, L. Moneta, A. Zsenei   2003-2005
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// Linear algebra routines of Minuit2 implemented with an external BLAS and LAPACK library.
+// They replace the routines translated from Fortran (mnd*.cxx, mnvert.cxx and the use of
+// mnteigen.cxx in LaEigenValues.cxx) if Minuit2 is built with MN_USE_BLAS (CMake option minuit2_blas).
+
+#ifdef MN_USE_BLAS
+
+#include "Minuit2/LASymMatrix.h"
+#include "Minuit2/LAVector.h"
+#include "Minuit2/MnPrint.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+extern "C" {
+double dasum_(const int *n, const double *dx, const int *incx);
+void daxpy_(const int *n, const double *da, const double *dx, const int *incx, double *dy, const int *incy);
+double ddot_(const int *n, const double *dx, const int *incx, const double *dy, const int *incy);
+void dscal_(const int *n, const double *da, double *dx, const int *incx);
+void dspmv_(const char *uplo, const int *n, const double *alpha, const double *ap, const double *x, const int *incx,
+            const double *beta, double *y, const int *incy);
+void dspr_(const char *uplo, const int *n, const double *alpha, const double *x, const int *incx, double *ap);
+void dsptrf_(const char *uplo, const int *n, double *ap, int *ipiv, int *info);
+void dsptri_(const char *uplo, const int *n, double *ap, const int *ipiv, double *work, int *info);
+void dspev_(const char *jobz, const char *uplo, const int *n, double *ap, double *w, double *z, const int *ldz,
+            double *work, int *info);
+}
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+double mndasum(unsigned int n, const double *dx, int incx)
+{
+   const int nn = n;
+   return dasum_(&nn, dx, &incx);
+}
+
+int Mndaxpy(unsigned int n, double da, const double *dx, int incx, double *dy, int incy)
+{
+   const int nn = n;
+   daxpy_(&nn, &da, dx, &incx, dy, &incy);
+   return 0;
+}
+
+double mnddot(unsigned int n, const double *dx, int incx, const double *dy, int incy)
+{
+   const int nn = n;
+   return ddot_(&nn, dx, &incx, dy, &incy);
+}
+
+int Mndscal(unsigned int n, double da, double *dx, int incx)
+{
+   const int nn = n;
+   dscal_(&nn, &da, dx, &incx);
+   return 0;
+}
+
+int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx, double beta,
+            double *y, int incy)
+{
+   const int nn = n;
+   dspmv_(uplo, &nn, &alpha, ap, x, &incx, &beta, y, &incy);
+   return 0;
+}
+
+int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
+{
+   const int nn = n;
+   dspr_(uplo, &nn, &alpha, x, &incx, ap);
+   return 0;
+}
+
+/** Inverts a symmetric matrix. Like the built-in version, the matrix is first scaled to have all
+    ones on the diagonal. It is then inverted with the Bunch-Kaufman factorization, which does not
+    require the matrix to be positive-definite.
+ */
+
+int mnvert(LASymMatrix &a)
+{
+   const int n = a.Nrow();
+   std::vector<double> s(n);
+   for (int i = 0; i < n; i++) {
+      double si = a(i, i);
+      if (!(si > 0.))
+         return 1;
+      s[i] = 1. / std::sqrt(si);
+   }
+
+   // the packed storage of LASymMatrix is the upper triangle by columns, as expected by LAPACK
+   double *ap = a.Data();
+   for (int k = 0; k < n; k++) {
+      double *col = ap + k * (k + 1) / 2;
+      for (int j = 0; j <= k; j++)
+         col[j] *= s[j] * s[k];
+   }
+
+   std::vector<int> ipiv(n);
+   std::vector<double> work(n);
+   int info = 0;
+   dsptrf_("U", &n, ap, ipiv.data(), &info);
+   if (info != 0)
+      return 1;
+   dsptri_("U", &n, ap, ipiv.data(), work.data(), &info);
+   if (info != 0)
+      return 1;
+
+   for (int k = 0; k < n; k++) {
+      double *col = ap + k * (k + 1) / 2;
+      for (int j = 0; j <= k; j++)
+         col[j] *= s[j] * s[k];
+   }
+
+   return 0;
+}
+
+LAVector eigenvalues(const LASymMatrix &mat)
+{
+   // calculate eigenvalues of symmetric matrices in ascending order using LAPACK DSPEV.
+   // If the iterations don't converge, the eigenvalues are NaN.
+   const int n = mat.Nrow();
+   std::vector<double> ap(mat.Data(), mat.Data() + mat.size());
+   std::vector<double> work(3 * n);
+   double z = 0.;
+   const int ldz = 1;
+   int info = 0;
+
+   LAVector result(n);
+   dspev_("N", "U", &n, ap.data(), result.Data(), &z, &ldz, work.data(), &info);
+   if (info != 0) {
+      MnPrint print("eigenvalues");
+      print.Error("LAPACK DSPEV fails with info", info);
+      for (int i = 0; i < n; i++)
+         result(i) = std::numeric_limits<double>::quiet_NaN();
+   }
+
+   return result;
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // MN_USE_BLAS
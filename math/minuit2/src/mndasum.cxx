@@ -14,6 +14,9 @@
 
 #include <cmath>
 
+// with MN_USE_BLAS this is implemented in mnblas.cxx
+#ifndef MN_USE_BLAS
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -93,3 +96,5 @@ L60:
 } // namespace Minuit2
 
 } // namespace ROOT
+
+#endif // MN_USE_BLAS
@@ -12,6 +12,9 @@
    -lf2c -lm   (in that order)
 */
 
+// with MN_USE_BLAS this is implemented in mnblas.cxx
+#ifndef MN_USE_BLAS
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -100,3 +103,5 @@ L60:
 } // namespace Minuit2
 
 } // namespace ROOT
+
+#endif // MN_USE_BLAS
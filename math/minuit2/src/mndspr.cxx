@@ -12,6 +12,9 @@
    -lf2c -lm   (in that order)
 */
 
+// with MN_USE_BLAS this is implemented in mnblas.cxx
+#ifndef MN_USE_BLAS
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -241,3 +244,5 @@ int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int
 } // namespace Minuit2
 
 } // namespace ROOT
+
+#endif // MN_USE_BLAS
@@ -11,6 +11,9 @@
 
 #include <cmath>
 
+// with MN_USE_BLAS this is implemented in mnblas.cxx
+#ifndef MN_USE_BLAS
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -18,6 +21,8 @@ namespace Minuit2 {
 /** Inverts a symmetric matrix. Matrix is first scaled to have all ones on
     the diagonal (equivalent to change of units) but no pivoting is done
     since matrix is positive-definite.
+    The loops run over the packed storage of the upper triangle by columns,
+    such that the innermost loops access contiguous memory and vectorize.
  */
 
 int mnvert(MnAlgebraicSymMatrix &a)
@@ -28,6 +33,12 @@ int mnvert(MnAlgebraicSymMatrix &a)
    MnAlgebraicVector q(nrow);
    MnAlgebraicVector pp(nrow);
 
+   // element (j, k) with j <= k is at ap[k * (k + 1) / 2 + j]
+   double *ap = a.Data();
+   double *ps = s.Data();
+   double *pq = q.Data();
+   double *ppp = pp.Data();
+
    for (unsigned int i = 0; i < nrow; i++) {
       double si = a(i, i);
       if (si < 0.)
@@ -35,40 +46,44 @@ int mnvert(MnAlgebraicSymMatrix &a)
       s(i) = 1. / std::sqrt(si);
    }
 
-   for (unsigned int i = 0; i < nrow; i++)
-      for (unsigned int j = i; j < nrow; j++)
-         a(i, j) *= (s(i) * s(j));
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *col = ap + k * (k + 1) / 2;
+      for (unsigned int j = 0; j <= k; j++)
+         col[j] *= (ps[j] * ps[k]);
+   }
 
-   for (unsigned i = 0; i < nrow; i++) {
-      unsigned int k = i;
-      if (a(k, k) == 0.)
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *colk = ap + k * (k + 1) / 2;
+      if (colk[k] == 0.)
          return 1;
-      q(k) = 1. / a(k, k);
-      pp(k) = 1.;
-      a(k, k) = 0.;
-      unsigned int kp1 = k + 1;
-      if (k != 0) {
-         for (unsigned int j = 0; j < k; j++) {
-            pp(j) = a(j, k);
-            q(j) = a(j, k) * q(k);
-            a(j, k) = 0.;
-         }
+      pq[k] = 1. / colk[k];
+      ppp[k] = 1.;
+      colk[k] = 0.;
+      for (unsigned int j = 0; j < k; j++) {
+         ppp[j] = colk[j];
+         pq[j] = colk[j] * pq[k];
+         colk[j] = 0.;
       }
-      if (k != nrow - 1) {
-         for (unsigned int j = kp1; j < nrow; j++) {
-            pp(j) = a(k, j);
-            q(j) = -a(k, j) * q(k);
-            a(k, j) = 0.;
-         }
+      for (unsigned int j = k + 1; j < nrow; j++) {
+         double &akj = ap[j * (j + 1) / 2 + k];
+         ppp[j] = akj;
+         pq[j] = -akj * pq[k];
+         akj = 0.;
+      }
+      // rank-one update of the upper triangle
+      for (unsigned int l = 0; l < nrow; l++) {
+         double *col = ap + l * (l + 1) / 2;
+         const double ql = pq[l];
+         for (unsigned int j = 0; j <= l; j++)
+            col[j] += ppp[j] * ql;
       }
-      for (unsigned int j = 0; j < nrow; j++)
-         for (k = j; k < nrow; k++)
-            a(j, k) += (pp(j) * q(k));
    }
 
-   for (unsigned int j = 0; j < nrow; j++)
-      for (unsigned int k = j; k < nrow; k++)
-         a(j, k) *= (s(j) * s(k));
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *col = ap + k * (k + 1) / 2;
+      for (unsigned int j = 0; j <= k; j++)
+         col[j] *= (ps[j] * ps[k]);
+   }
 
    return 0;
 }
@@ -76,3 +91,5 @@ int mnvert(MnAlgebraicSymMatrix &a)
 } // namespace Minuit2
 
 } // namespace ROOT
+
+#endif // MN_USE_BLAS
@@ -0,0 +1,76 @@
+// Straight line fit shared by the tests of MnHesse and MnExecutor
+
+#ifndef MN_LineFit_H_
+#define MN_LineFit_H_
+
+#include "Minuit2/MnUserParameters.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/// Negative log-likelihood of a straight line y = a + b * t with Gaussian scatter of width sigma, with its exact
+/// gradient. The parameters a and b are correlated, and the likelihood is not quadratic in sigma.
+class LineFit {
+public:
+   static constexpr int kNPoints = 200;
+
+   LineFit()
+   {
+      std::mt19937 engine{4321};
+      std::normal_distribution<double> noise{0., 0.5};
+      for (int i = 0; i < kNPoints; ++i) {
+         fT.push_back(0.05 * i);
+         fY.push_back(1. + 2. * fT.back() + noise(engine));
+      }
+   }
+
+   double operator()(const double *par) const
+   {
+      const double a = par[0], b = par[1], sigma = par[2];
+      double nll = 0.;
+      for (std::size_t i = 0; i < fT.size(); ++i) {
+         const double r = (fY[i] - a - b * fT[i]) / sigma;
+         nll += 0.5 * r * r + std::log(sigma);
+      }
+      return nll;
+   }
+
+   std::vector<double> Gradient(const double *par) const
+   {
+      const double a = par[0], b = par[1], sigma = par[2];
+      std::vector<double> grad(3);
+      for (std::size_t i = 0; i < fT.size(); ++i) {
+         const double r = (fY[i] - a - b * fT[i]) / sigma;
+         grad[0] -= r / sigma;
+         grad[1] -= r * fT[i] / sigma;
+         grad[2] += (1. - r * r) / sigma;
+      }
+      return grad;
+   }
+
+   /// Starting values of the parameters. The limits make the internal parameter of sigma a non-linear
+   /// transformation of the external one.
+   static MnUserParameters Parameters()
+   {
+      MnUserParameters upar;
+      upar.Add("a", 0.5, 0.1);
+      upar.Add("b", 1.5, 0.1);
+      upar.Add("sigma", 1., 0.1, 0.1, 2.);
+      return upar;
+   }
+
+private:
+   std::vector<double> fT;
+   std::vector<double> fY;
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // MN_LineFit_H_
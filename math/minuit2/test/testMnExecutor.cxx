@@ -0,0 +1,321 @@
+// Tests of the concurrent function calls of MnHesse and MnMinos with an MnExecutor
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FCNGradAdapter.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MinosError.h"
+#include "Minuit2/Minuit2Minimizer.h"
+#include "Minuit2/MnExecutor.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnMinos.h"
+#include "Minuit2/MnPrint.h"
+#include "Minuit2/MnStrategy.h"
+
+#include "Math/GenAlgoOptions.h"
+#include "Math/IFunction.h"
+
+#include "LineFit.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+namespace {
+
+/// Thread safe FCN, which counts its calls and can be set up to throw once a number of calls is reached.
+class LineFitFCN : public FCNBase {
+public:
+   double operator()(const std::vector<double> &par) const override
+   {
+      if (++fNCalls > fThrowAfter)
+         throw std::runtime_error("LineFitFCN: too many calls");
+      return fLineFit(par.data());
+   }
+
+   double Up() const override { return 0.5; }
+
+   bool IsThreadSafe() const override { return true; }
+
+   void ThrowAfter(int ncalls)
+   {
+      fNCalls = 0;
+      fThrowAfter = ncalls;
+   }
+
+private:
+   LineFit fLineFit;
+   mutable std::atomic<int> fNCalls{0};
+   int fThrowAfter = std::numeric_limits<int>::max();
+};
+
+/// Function for the Minuit2Minimizer, which records the threads it is called from.
+class LineFitFunction : public ROOT::Math::IMultiGenFunction {
+public:
+   explicit LineFitFunction(bool threadSafe) : fThreadSafe{threadSafe} {}
+
+   ROOT::Math::IMultiGenFunction *Clone() const override { return new LineFitFunction(fThreadSafe); }
+   unsigned int NDim() const override { return 3; }
+   bool IsThreadSafe() const override { return fThreadSafe; }
+
+   std::set<std::thread::id> Threads() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fThreads;
+   }
+
+private:
+   double DoEval(const double *par) const override
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fThreads.insert(std::this_thread::get_id());
+      }
+      return fLineFit(par);
+   }
+
+   bool fThreadSafe;
+   LineFit fLineFit;
+   mutable std::mutex fMutex;
+   mutable std::set<std::thread::id> fThreads;
+};
+
+/// Function with gradient and Hessian for the FCNGradAdapter. The Hessian is computed from differences of the
+/// gradient.
+class LineFitGradFunction : public ROOT::Math::IMultiGradFunction {
+public:
+   ROOT::Math::IMultiGenFunction *Clone() const override { return new LineFitGradFunction; }
+   unsigned int NDim() const override { return 3; }
+
+   void Gradient(const double *x, double *grad) const override
+   {
+      std::vector<double> g = fLineFit.Gradient(x);
+      std::copy(g.begin(), g.end(), grad);
+   }
+
+   bool Hessian(const std::vector<double> &x, double *hess) const
+   {
+      const double d = 1e-5;
+      for (unsigned int i = 0; i < 3; ++i) {
+         std::vector<double> xPlus = x;
+         std::vector<double> xMinus = x;
+         xPlus[i] += d;
+         xMinus[i] -= d;
+         std::vector<double> gPlus = fLineFit.Gradient(xPlus.data());
+         std::vector<double> gMinus = fLineFit.Gradient(xMinus.data());
+         for (unsigned int j = 0; j < 3; ++j)
+            hess[i * 3 + j] = (gPlus[j] - gMinus[j]) / (2. * d);
+      }
+      return true;
+   }
+
+private:
+   double DoEval(const double *x) const override { return fLineFit(x); }
+   double DoDerivative(const double *x, unsigned int icoord) const override { return fLineFit.Gradient(x)[icoord]; }
+
+   LineFit fLineFit;
+};
+
+/// Executor that runs the tasks serially and counts them.
+class CountingExecutor : public MnExecutor {
+public:
+   unsigned int NWorkers() const override { return 1; }
+   unsigned int NTasks() const { return fNTasks; }
+
+private:
+   void DoForeach(unsigned int n, const std::function<void(unsigned int)> &task) const override
+   {
+      for (unsigned int i = 0; i < n; ++i) {
+         ++fNTasks;
+         task(i);
+      }
+   }
+
+   mutable unsigned int fNTasks = 0;
+};
+
+MnStrategy parallelStrategy(unsigned int level = 1)
+{
+   MnStrategy strategy{level};
+   strategy.SetExecutor(std::make_shared<MnThreadExecutor>(4));
+   return strategy;
+}
+
+void expectSameCovariance(const MnUserCovariance &cov, const MnUserCovariance &ref)
+{
+   ASSERT_EQ(cov.Nrow(), ref.Nrow());
+   for (unsigned int i = 0; i < ref.Nrow(); ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         EXPECT_NEAR(cov(i, j), ref(i, j), 1e-10 * std::sqrt(ref(i, i) * ref(j, j)))
+            << "element (" << i << ", " << j << ")";
+      }
+   }
+}
+
+} // namespace
+
+// The Hessian computed with concurrent function calls is the same as the serial one.
+TEST(MnExecutor, HesseSerialAndConcurrent)
+{
+   LineFitFCN fcn;
+
+   for (unsigned int level : {0u, 1u, 2u}) {
+      // the copies of a FunctionMinimum share their states, so each Hesse gets its own minimization
+      FunctionMinimum minSerial = MnMigrad{fcn, LineFit::Parameters()}();
+      FunctionMinimum minConcurrent = MnMigrad{fcn, LineFit::Parameters()}();
+      ASSERT_TRUE(minSerial.IsValid());
+      MnHesse{MnStrategy{level}}(fcn, minSerial);
+      MnHesse{parallelStrategy(level)}(fcn, minConcurrent);
+      ASSERT_TRUE(minConcurrent.UserState().HasCovariance());
+      expectSameCovariance(minConcurrent.UserState().Covariance(), minSerial.UserState().Covariance());
+   }
+}
+
+// The Minos errors searched concurrently are the same as the serial ones.
+TEST(MnExecutor, MinosSerialAndConcurrent)
+{
+   LineFitFCN fcn;
+   FunctionMinimum min = MnMigrad{fcn, LineFit::Parameters()}();
+   ASSERT_TRUE(min.IsValid());
+
+   MnMinos serial{fcn, min};
+   MnMinos concurrent{fcn, min, parallelStrategy()};
+   std::vector<MinosError> all = concurrent.Minos(std::vector<unsigned int>{0, 1, 2});
+   ASSERT_EQ(all.size(), 3u);
+   for (unsigned int par = 0; par < 3; ++par) {
+      MinosError ref = serial.Minos(par);
+      ASSERT_TRUE(ref.IsValid());
+      for (MinosError const &err : {concurrent.Minos(par), all[par]}) {
+         EXPECT_TRUE(err.IsValid());
+         EXPECT_EQ(err.Parameter(), par);
+         EXPECT_NEAR(err.Lower(), ref.Lower(), 1e-10 * std::abs(ref.Lower()));
+         EXPECT_NEAR(err.Upper(), ref.Upper(), 1e-10 * std::abs(ref.Upper()));
+      }
+   }
+}
+
+// An exception thrown by a task is rethrown by Foreach, also from inside MnHesse.
+TEST(MnExecutor, ExceptionPropagation)
+{
+   MnThreadExecutor executor{4};
+   EXPECT_THROW(executor.Foreach(100,
+                                 [](unsigned int i) {
+                                    if (i == 10)
+                                       throw std::runtime_error("task failed");
+                                 }),
+                std::runtime_error);
+
+   LineFitFCN fcn;
+   FunctionMinimum min = MnMigrad{fcn, LineFit::Parameters()}();
+   ASSERT_TRUE(min.IsValid());
+   fcn.ThrowAfter(5);
+   EXPECT_THROW(MnHesse{parallelStrategy()}(fcn, min), std::runtime_error);
+}
+
+// The tasks run with the print level of the calling thread.
+TEST(MnExecutor, PrintLevel)
+{
+   const int prevLevel = MnPrint::SetGlobalLevel(3);
+   std::vector<int> levels(16, -1);
+   MnThreadExecutor{4}.Foreach(levels.size(), [&](unsigned int i) { levels[i] = MnPrint::GlobalLevel(); });
+   MnPrint::SetGlobalLevel(prevLevel);
+   for (int level : levels)
+      EXPECT_EQ(level, 3);
+   EXPECT_EQ(MnPrint::GlobalLevel(), prevLevel);
+}
+
+// The executor is only used if the FCN is thread safe.
+TEST(MnExecutor, OnlyForThreadSafeFCN)
+{
+   struct NotThreadSafeFCN : public LineFitFCN {
+      bool IsThreadSafe() const override { return false; }
+   };
+
+   auto executor = std::make_shared<CountingExecutor>();
+   MnStrategy strategy{1};
+   strategy.SetExecutor(executor);
+
+   NotThreadSafeFCN notThreadSafe;
+   FunctionMinimum min = MnMigrad{notThreadSafe, LineFit::Parameters()}();
+   MnHesse{strategy}(notThreadSafe, min);
+   MnMinos{notThreadSafe, min, strategy}.Minos(0);
+   EXPECT_EQ(executor->NTasks(), 0u);
+
+   LineFitFCN threadSafe;
+   MnHesse{strategy}(threadSafe, min);
+   MnMinos{threadSafe, min, strategy}.Minos(0);
+   EXPECT_GT(executor->NTasks(), 0u);
+}
+
+// The NThreads option of the Minuit2Minimizer does not make a function thread safe that does not declare it.
+TEST(MnExecutor, Minuit2MinimizerNThreads)
+{
+   ROOT::Math::GenAlgoOptions extraOptions;
+   extraOptions.SetValue("NThreads", 4);
+
+   std::vector<double> errors[2];
+   for (bool threadSafe : {false, true}) {
+      LineFitFunction func{threadSafe};
+      ROOT::Minuit2::Minuit2Minimizer minimizer;
+      minimizer.SetPrintLevel(-1);
+      minimizer.SetExtraOptions(extraOptions);
+      minimizer.SetFunction(func);
+      minimizer.SetVariable(0, "a", 0.5, 0.1);
+      minimizer.SetVariable(1, "b", 1.5, 0.1);
+      minimizer.SetLimitedVariable(2, "sigma", 1., 0.1, 0.1, 2.);
+      ASSERT_TRUE(minimizer.Minimize());
+      ASSERT_TRUE(minimizer.Hesse());
+      double errLow = 0.;
+      double errUp = 0.;
+      ASSERT_TRUE(minimizer.GetMinosError(2, errLow, errUp));
+
+      if (!threadSafe) {
+         EXPECT_EQ(func.Threads(), std::set<std::thread::id>{std::this_thread::get_id()});
+      }
+      errors[threadSafe] = {minimizer.Errors()[0], minimizer.Errors()[1], minimizer.Errors()[2], errLow, errUp};
+   }
+   for (std::size_t i = 0; i < errors[0].size(); ++i)
+      EXPECT_NEAR(errors[1][i], errors[0][i], 1e-10 * std::abs(errors[0][i]));
+}
+
+// The Hessian and second derivatives of the FCNGradAdapter can be computed concurrently, and a Hessian function that
+// fails is not used again.
+TEST(MnExecutor, GradAdapterHessian)
+{
+   LineFitGradFunction func;
+   FCNGradAdapter<ROOT::Math::IMultiGradFunction> fcn{func, 0.5};
+   fcn.SetHessianFunction([&](const std::vector<double> &x, double *hess) { return func.Hessian(x, hess); });
+   ASSERT_TRUE(fcn.HasHessian());
+
+   const std::vector<double> x{1., 2., 0.5};
+   const std::vector<double> hessian = fcn.Hessian(x);
+   ASSERT_EQ(hessian.size(), 9u);
+   std::vector<std::vector<double>> hessians(64);
+   std::vector<std::vector<double>> g2s(64);
+   MnThreadExecutor{4}.Foreach(hessians.size(), [&](unsigned int i) {
+      hessians[i] = fcn.Hessian(x);
+      g2s[i] = fcn.G2(x);
+   });
+   for (unsigned int i = 0; i < hessians.size(); ++i) {
+      EXPECT_EQ(hessians[i], hessian);
+      EXPECT_EQ(g2s[i], (std::vector<double>{hessian[0], hessian[4], hessian[8]}));
+   }
+
+   fcn.SetHessianFunction([](const std::vector<double> &, double *) { return false; });
+   EXPECT_TRUE(fcn.HasHessian());
+   EXPECT_TRUE(fcn.Hessian(x).empty());
+   EXPECT_FALSE(fcn.HasHessian());
+   EXPECT_TRUE(fcn.G2(x).empty());
+}
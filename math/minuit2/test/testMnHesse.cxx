@@ -0,0 +1,119 @@
+// Tests of the Hessian calculation of Minuit2 with MnHesse
+
+#include "Minuit2/FCNGradientBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnUserParameterState.h"
+
+#include "LineFit.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+namespace {
+
+/// FCN of the line fit with its exact gradient.
+class LineFitFCN : public FCNGradientBase {
+public:
+   double operator()(const std::vector<double> &par) const override
+   {
+      ++fNCalls;
+      return fLineFit(par.data());
+   }
+
+   std::vector<double> Gradient(const std::vector<double> &par) const override
+   {
+      ++fNGradCalls;
+      return fLineFit.Gradient(par.data());
+   }
+
+   double Up() const override { return 0.5; }
+
+   unsigned int NCalls() const { return fNCalls; }
+   unsigned int NGradCalls() const { return fNGradCalls; }
+
+private:
+   LineFit fLineFit;
+   mutable unsigned int fNCalls = 0;
+   mutable unsigned int fNGradCalls = 0;
+};
+
+/// Compare the covariance matrices entry by entry, relative to the errors of the parameters.
+void expectSameCovariance(const MnUserParameterState &state, const MnUserParameterState &reference)
+{
+   ASSERT_TRUE(state.HasCovariance());
+   ASSERT_TRUE(reference.HasCovariance());
+   const MnUserCovariance &cov = state.Covariance();
+   const MnUserCovariance &ref = reference.Covariance();
+   ASSERT_EQ(cov.Nrow(), ref.Nrow());
+   for (unsigned int i = 0; i < ref.Nrow(); ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         EXPECT_NEAR(cov(i, j), ref(i, j), 1e-3 * std::sqrt(ref(i, i) * ref(j, j))) << "element (" << i << ", " << j
+                                                                                   << ")";
+      }
+   }
+}
+
+} // namespace
+
+// The Hessian from finite differences of an exact gradient agrees with the Hessian from second differences of the
+// function values, also for a parameter with limits.
+TEST(MnHesse, HessianFromGradient)
+{
+   LineFitFCN fcn;
+
+   MnStrategy numerical{1};
+   MnStrategy fromGradient{1};
+   fromGradient.SetHessianFromGradient(1);
+
+   // Hesse at the minimum state, where an error estimate is available to set the step sizes. The copies of a
+   // FunctionMinimum share their states, so each Hesse gets its own minimization.
+   FunctionMinimum minNumerical = MnMigrad{fcn, LineFit::Parameters(), numerical}();
+   FunctionMinimum minFromGradient = MnMigrad{fcn, LineFit::Parameters(), numerical}();
+   ASSERT_TRUE(minNumerical.IsValid());
+   MnHesse{numerical}(fcn, minNumerical);
+   MnHesse{fromGradient}(fcn, minFromGradient);
+   ASSERT_TRUE(minFromGradient.IsValid());
+   expectSameCovariance(minFromGradient.UserState(), minNumerical.UserState());
+
+   // Hesse on user parameters without an error matrix
+   MnUserParameterState stateNumerical = MnHesse{numerical}(fcn, minNumerical.UserParameters());
+   MnUserParameterState stateFromGradient = MnHesse{fromGradient}(fcn, minNumerical.UserParameters());
+   EXPECT_TRUE(stateFromGradient.IsValid());
+   expectSameCovariance(stateFromGradient, stateNumerical);
+
+   // at the maximum of the likelihood, the error of the fitted width is sigma / sqrt(2 N)
+   EXPECT_NEAR(stateFromGradient.Error("sigma"), stateFromGradient.Value("sigma") / std::sqrt(2. * LineFit::kNPoints),
+               1e-4);
+}
+
+// The 2n gradient evaluations of the Hessian from the gradient are counted as function calls, and are limited by
+// the maximum number of calls.
+TEST(MnHesse, HessianFromGradientCalls)
+{
+   LineFitFCN fcn;
+   MnStrategy fromGradient{1};
+   fromGradient.SetHessianFromGradient(1);
+
+   FunctionMinimum min = MnMigrad{fcn, LineFit::Parameters()}();
+   ASSERT_TRUE(min.IsValid());
+   const unsigned int n = min.UserState().VariableParameters();
+   const int nfcn = min.NFcn();
+
+   unsigned int nGradCalls = fcn.NGradCalls();
+   MnHesse{fromGradient}(fcn, min, nfcn + 2 * n - 1);
+   EXPECT_EQ(fcn.NGradCalls(), nGradCalls);
+   EXPECT_TRUE(min.State().Error().HasReachedCallLimit());
+   EXPECT_EQ(min.NFcn(), nfcn);
+
+   MnHesse{fromGradient}(fcn, min, nfcn + 2 * n);
+   EXPECT_EQ(fcn.NGradCalls() - nGradCalls, 2 * n);
+   EXPECT_FALSE(min.State().Error().HasReachedCallLimit());
+   EXPECT_EQ(min.NFcn(), static_cast<int>(nfcn + 2 * n));
+}
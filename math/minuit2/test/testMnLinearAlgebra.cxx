@@ -0,0 +1,184 @@
+// Tests of the inversion and the eigenvalues of symmetric matrices in Minuit2, with the built-in routines or with
+// BLAS and LAPACK (MN_USE_BLAS)
+
+#include "Minuit2/LASymMatrix.h"
+#include "Minuit2/LAVector.h"
+#include "Minuit2/MnEigen.h"
+#include "Minuit2/MnUserCovariance.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+namespace {
+
+/// Inversion of the built-in mnvert before its loops were reordered for contiguous memory access. The built-in
+/// routine gives bit-identical results.
+int referenceInvert(LASymMatrix &a)
+{
+   unsigned int nrow = a.Nrow();
+   LAVector s(nrow);
+   LAVector q(nrow);
+   LAVector pp(nrow);
+
+   for (unsigned int i = 0; i < nrow; i++) {
+      double si = a(i, i);
+      if (si < 0.)
+         return 1;
+      s(i) = 1. / std::sqrt(si);
+   }
+
+   for (unsigned int i = 0; i < nrow; i++)
+      for (unsigned int j = i; j < nrow; j++)
+         a(i, j) *= (s(i) * s(j));
+
+   for (unsigned i = 0; i < nrow; i++) {
+      unsigned int k = i;
+      if (a(k, k) == 0.)
+         return 1;
+      q(k) = 1. / a(k, k);
+      pp(k) = 1.;
+      a(k, k) = 0.;
+      unsigned int kp1 = k + 1;
+      if (k != 0) {
+         for (unsigned int j = 0; j < k; j++) {
+            pp(j) = a(j, k);
+            q(j) = a(j, k) * q(k);
+            a(j, k) = 0.;
+         }
+      }
+      if (k != nrow - 1) {
+         for (unsigned int j = kp1; j < nrow; j++) {
+            pp(j) = a(k, j);
+            q(j) = -a(k, j) * q(k);
+            a(k, j) = 0.;
+         }
+      }
+      for (unsigned int j = 0; j < nrow; j++)
+         for (k = j; k < nrow; k++)
+            a(j, k) += (pp(j) * q(k));
+   }
+
+   for (unsigned int j = 0; j < nrow; j++)
+      for (unsigned int k = j; k < nrow; k++)
+         a(j, k) *= (s(j) * s(k));
+
+   return 0;
+}
+
+/// Symmetric matrix Q diag(lambda) Q^T with known eigenvalues, where Q is the orthogonal matrix of the discrete sine
+/// transform.
+LASymMatrix fromEigenvalues(const std::vector<double> &lambda)
+{
+   const unsigned int n = lambda.size();
+   const double pi = std::acos(-1.);
+   std::vector<double> q(n * n);
+   for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int k = 0; k < n; ++k)
+         q[i * n + k] = std::sqrt(2. / (n + 1)) * std::sin((i + 1) * (k + 1) * pi / (n + 1));
+   }
+   LASymMatrix a(n);
+   for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         double aij = 0.;
+         for (unsigned int k = 0; k < n; ++k)
+            aij += q[i * n + k] * lambda[k] * q[j * n + k];
+         a(i, j) = aij;
+      }
+   }
+   return a;
+}
+
+enum class Kind { kPosDef, kIndefinite, kIllConditioned };
+
+/// Eigenvalues in ascending order. The indefinite matrices have negative eigenvalues from n = 4 on, the
+/// ill-conditioned ones have a condition number of 1e10.
+std::vector<double> eigenvaluesOf(Kind kind, unsigned int n)
+{
+   std::vector<double> lambda(n);
+   for (unsigned int k = 0; k < n; ++k) {
+      switch (kind) {
+      case Kind::kPosDef: lambda[k] = 1. + k; break;
+      case Kind::kIndefinite: lambda[k] = k + 0.5 - n / 4; break;
+      case Kind::kIllConditioned: lambda[k] = n == 1 ? 1. : std::pow(10., -10. + 10. * k / (n - 1)); break;
+      }
+   }
+   return lambda;
+}
+
+std::string name(Kind kind, unsigned int n)
+{
+   const char *names[] = {"positive-definite", "indefinite", "ill-conditioned"};
+   return std::string(names[static_cast<int>(kind)]) + " n = " + std::to_string(n);
+}
+
+const std::vector<unsigned int> sizes{1, 2, 3, 4, 5, 10, 31, 64, 100, 200};
+
+} // namespace
+
+// The inverse agrees with the one from the known eigenvalues, and with the built-in routine it is bit-identical to
+// the inverse before the loops were reordered.
+TEST(MnLinearAlgebra, Invert)
+{
+   for (Kind kind : {Kind::kPosDef, Kind::kIndefinite, Kind::kIllConditioned}) {
+      for (unsigned int n : sizes) {
+         SCOPED_TRACE(name(kind, n));
+         const std::vector<double> lambda = eigenvaluesOf(kind, n);
+         std::vector<double> inverseLambda(n);
+         double cond = 1.;
+         for (unsigned int k = 0; k < n; ++k) {
+            inverseLambda[k] = 1. / lambda[k];
+            cond = std::max(cond, std::abs(lambda[k]) / std::abs(lambda[0]));
+            cond = std::max(cond, std::abs(lambda[n - 1]) / std::abs(lambda[k]));
+         }
+         const LASymMatrix a = fromEigenvalues(lambda);
+         const LASymMatrix expected = fromEigenvalues(inverseLambda);
+
+         LASymMatrix inverse = a;
+         ASSERT_EQ(Invert(inverse), 0);
+         LASymMatrix reference = a;
+         ASSERT_EQ(referenceInvert(reference), 0);
+
+         double maxExpected = 0.;
+         for (unsigned int i = 0; i < a.size(); ++i)
+            maxExpected = std::max(maxExpected, std::abs(expected.Data()[i]));
+         for (unsigned int i = 0; i < n; ++i) {
+            for (unsigned int j = 0; j <= i; ++j) {
+               EXPECT_NEAR(inverse(i, j), expected(i, j), 1e-13 * n * cond * maxExpected)
+                  << "element (" << i << ", " << j << ")";
+#ifndef MN_USE_BLAS
+               EXPECT_EQ(inverse(i, j), reference(i, j)) << "element (" << i << ", " << j << ")";
+#endif
+            }
+         }
+      }
+   }
+}
+
+// The eigenvalues are the known ones, in ascending order.
+TEST(MnLinearAlgebra, Eigenvalues)
+{
+   for (Kind kind : {Kind::kPosDef, Kind::kIndefinite, Kind::kIllConditioned}) {
+      for (unsigned int n : sizes) {
+         SCOPED_TRACE(name(kind, n));
+         const std::vector<double> lambda = eigenvaluesOf(kind, n);
+         const LASymMatrix a = fromEigenvalues(lambda);
+         MnUserCovariance cov(n);
+         for (unsigned int i = 0; i < n; ++i) {
+            for (unsigned int j = 0; j <= i; ++j)
+               cov(i, j) = a(i, j);
+         }
+
+         const std::vector<double> eigen = MnEigen{}(cov);
+         ASSERT_EQ(eigen.size(), n);
+         const double scale = std::max(std::abs(lambda.front()), std::abs(lambda.back()));
+         for (unsigned int k = 0; k < n; ++k)
+            EXPECT_NEAR(eigen[k], lambda[k], 1e-12 * n * scale) << "eigenvalue " << k;
+      }
+   }
+}
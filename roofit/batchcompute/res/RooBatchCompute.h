@@ -22,6 +22,10 @@
 #include <memory>
 #include <string>
 
+namespace ROOT {
+class TThreadExecutor;
+}
+
 /**
  * Namespace for dispatching RooFit computations to various backends.
  *
@@ -58,8 +62,15 @@ public:
    void setCudaStream(CudaInterface::CudaStream *cudaStream) { _cudaStream = cudaStream; }
    CudaInterface::CudaStream *cudaStream() const { return _cudaStream; }
 
+   /// Thread pool over which the CPU computations on large arrays are split, or nullptr to
+   /// compute them in the calling thread. It is owned by the RooFit::Evaluator and shared
+   /// by the configurations of all its nodes.
+   ROOT::TThreadExecutor *threadExecutor() const { return _threadExecutor.get(); }
+   void setThreadExecutor(std::shared_ptr<ROOT::TThreadExecutor> executor) { _threadExecutor = std::move(executor); }
+
 private:
    CudaInterface::CudaStream *_cudaStream = nullptr;
+   std::shared_ptr<ROOT::TThreadExecutor> _threadExecutor;
 };
 
 enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
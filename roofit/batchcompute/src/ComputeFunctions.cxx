@@ -21,6 +21,11 @@ computation. In case of cuda computations, the loops have a step (stride) the si
 which allows for reusing the same code as the cpu implementations, easier debugging and in terms
 of performance, maximum memory coalescing. For more details, see
 https://developer.nvidia.com/blog/cuda-pro-tip-write-flexible-kernels-grid-stride-loops/
+
+On the cpu, the loops are vectorized by the compiler for the instruction set of each library
+variant (see RooBatchCompute::initCPU()). The compilers only vectorize loops without
+data-dependent control flow, so piecewise functions should compute all pieces that are cheap
+and select the result with the ternary operator instead of branching.
 **/
 
 #include "RooBatchCompute.h"
@@ -48,12 +53,16 @@ namespace RF_ARCH {
 __rooglobal__ void computeAddPdf(Batches &batches)
 {
    const int nPdfs = batches.nExtra;
+   const double coef0 = batches.extra[0];
+   Batch pdf0 = batches.args[0];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      batches.output[i] = batches.extra[0] * batches.args[0][i];
+      batches.output[i] = coef0 * pdf0[i];
    }
    for (int pdf = 1; pdf < nPdfs; pdf++) {
+      const double coef = batches.extra[pdf];
+      Batch pdfVals = batches.args[pdf];
       for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-         batches.output[i] += batches.extra[pdf] * batches.args[pdf][i];
+         batches.output[i] += coef * pdfVals[i];
       }
    }
 }
@@ -70,11 +79,7 @@ __rooglobal__ void computeArgusBG(Batches &batches)
       batches.output[i] = c[i] * u + p[i] * fast_log(u);
    }
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      if (m[i] >= m0[i]) {
-         batches.output[i] = 0.0;
-      } else {
-         batches.output[i] = m[i] * fast_exp(batches.output[i]);
-      }
+      batches.output[i] = m[i] >= m0[i] ? 0.0 : m[i] * fast_exp(batches.output[i]);
    }
 }
 
@@ -176,13 +181,9 @@ __rooglobal__ void computeBifurGauss(Batches &batches)
    Batch SL = batches.args[2];
    Batch SR = batches.args[3];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double arg = X[i] - M[i];
-      if (arg < 0) {
-         arg /= SL[i];
-      } else {
-         arg /= SR[i];
-      }
-      batches.output[i] = fast_exp(-0.5 * arg * arg);
+      const double arg = X[i] - M[i];
+      const double t = arg / (arg < 0 ? SL[i] : SR[i]);
+      batches.output[i] = fast_exp(-0.5 * t * t);
    }
 }
 
@@ -216,31 +217,25 @@ __rooglobal__ void computeBukin(Batches &batches)
       const double x1 = XP[i] + 0.5 * SP[i] * r7 * (r1 - 1);
       const double x2 = XP[i] + 0.5 * SP[i] * r7 * (r1 + 1);
 
-      double r5 = 1.0;
-      if (XI[i] > r6 || XI[i] < -r6)
-         r5 = XI[i] / fast_log(r4 + XI[i]);
-
-      double factor = 1;
-      double y = X[i] - x1;
-      double Yp = XP[i] - x1;
-      double yi = r4 - XI[i];
-      double rho = R1[i];
-      if (X[i] >= x2) {
-         factor = -1;
-         y = X[i] - x2;
-         Yp = XP[i] - x2;
-         yi = r4 + XI[i];
-         rho = R2[i];
-      }
+      const double r5 = XI[i] > r6 || XI[i] < -r6 ? XI[i] / fast_log(r4 + XI[i]) : 1.0;
 
-      batches.output[i] = rho * y * y / Yp / Yp - r3 + factor * 4 * r3 * y * hp * r5 * r4 / yi / yi;
-      if (X[i] >= x1 && X[i] < x2) {
-         batches.output[i] =
-            fast_log(1 + 4 * XI[i] * r4 * (X[i] - XP[i]) * hp) / fast_log(1 + 2 * XI[i] * (XI[i] - r4));
-         batches.output[i] *= -batches.output[i] * r3;
-      }
-      if (X[i] >= x1 && X[i] < x2 && XI[i] < r6 && XI[i] > -r6)
-         batches.output[i] = -4 * r3 * (X[i] - XP[i]) * (X[i] - XP[i]) * hp * hp;
+      // tails
+      const bool isRight = X[i] >= x2;
+      const double factor = isRight ? -1 : 1;
+      const double xEdge = isRight ? x2 : x1;
+      const double y = X[i] - xEdge;
+      const double Yp = XP[i] - xEdge;
+      const double yi = isRight ? r4 + XI[i] : r4 - XI[i];
+      const double rho = isRight ? R2[i] : R1[i];
+      const double tail = rho * y * y / Yp / Yp - r3 + factor * 4 * r3 * y * hp * r5 * r4 / yi / yi;
+
+      // core
+      const double logCore =
+         fast_log(1 + 4 * XI[i] * r4 * (X[i] - XP[i]) * hp) / fast_log(1 + 2 * XI[i] * (XI[i] - r4));
+      const double core = XI[i] < r6 && XI[i] > -r6 ? -4 * r3 * (X[i] - XP[i]) * (X[i] - XP[i]) * hp * hp
+                                                     : logCore * (-logCore * r3);
+
+      batches.output[i] = X[i] >= x1 && X[i] < x2 ? core : tail;
    }
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP)
       batches.output[i] = fast_exp(batches.output[i]);
@@ -255,14 +250,9 @@ __rooglobal__ void computeCBShape(Batches &batches)
    Batch N = batches.args[4];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
       const double t = (M[i] - M0[i]) / S[i];
-      if ((A[i] > 0 && t >= -A[i]) || (A[i] < 0 && -t >= A[i])) {
-         batches.output[i] = -0.5 * t * t;
-      } else {
-         batches.output[i] = N[i] / (N[i] - A[i] * A[i] - A[i] * t);
-         batches.output[i] = fast_log(batches.output[i]);
-         batches.output[i] *= N[i];
-         batches.output[i] -= 0.5 * A[i] * A[i];
-      }
+      const bool isGaussian = (A[i] > 0 && t >= -A[i]) || (A[i] < 0 && -t >= A[i]);
+      const double tail = N[i] * fast_log(N[i] / (N[i] - A[i] * A[i] - A[i] * t)) - 0.5 * A[i] * A[i];
+      batches.output[i] = isGaussian ? -0.5 * t * t : tail;
    }
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP)
       batches.output[i] = fast_exp(batches.output[i]);
@@ -276,23 +266,25 @@ __rooglobal__ void computeChebychev(Batches &batches)
    const double xmax = batches.extra[nCoef + 1];
 
    if (STEP == 1) {
-      double prev[bufferSize][2];
+      // separate arrays for the two previous orders, such that all loads are contiguous
+      double prev0[bufferSize];
+      double prev1[bufferSize];
       double X[bufferSize];
 
       for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-         // set a0-->prev[i][0] and a1-->prev[i][1]
+         // set a0-->prev0[i] and a1-->prev1[i]
          // and x tranfsformed to range[-1..1]-->X[i]
-         prev[i][0] = batches.output[i] = 1.0;
-         prev[i][1] = X[i] = 2 * (xData[i] - 0.5 * (xmax + xmin)) / (xmax - xmin);
+         prev0[i] = batches.output[i] = 1.0;
+         prev1[i] = X[i] = 2 * (xData[i] - 0.5 * (xmax + xmin)) / (xmax - xmin);
       }
       for (int k = 0; k < nCoef; k++) {
          for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-            batches.output[i] += prev[i][1] * batches.extra[k];
+            batches.output[i] += prev1[i] * batches.extra[k];
 
             // compute next order
-            const double next = 2 * X[i] * prev[i][1] - prev[i][0];
-            prev[i][0] = prev[i][1];
-            prev[i][1] = next;
+            const double next = 2 * X[i] * prev1[i] - prev0[i];
+            prev0[i] = prev1[i];
+            prev1[i] = next;
          }
       }
    } else {
@@ -330,8 +322,9 @@ __rooglobal__ void computeChiSquare(Batches &batches)
 
 __rooglobal__ void computeDeltaFunction(Batches &batches)
 {
+   Batch x = batches.args[0];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      batches.output[i] = 0.0 + (batches.args[0][i] == 1.0);
+      batches.output[i] = 0.0 + (x[i] == 1.0);
    }
 }
 
@@ -408,15 +401,10 @@ __rooglobal__ void computeGamma(Batches &batches)
    }
 
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      if (X[i] != M[i]) {
-         const double invBeta = 1 / B[i];
-         double arg = (X[i] - M[i]) * invBeta;
-         batches.output[i] -= arg;
-         arg = fast_log(arg);
-         batches.output[i] += arg * (G[i] - 1);
-         batches.output[i] = fast_exp(batches.output[i]);
-         batches.output[i] *= invBeta;
-      }
+      const double invBeta = 1 / B[i];
+      const double arg = (X[i] - M[i]) * invBeta;
+      const double result = fast_exp(batches.output[i] - arg + fast_log(arg) * (G[i] - 1)) * invBeta;
+      batches.output[i] = X[i] != M[i] ? result : batches.output[i];
    }
 }
 
@@ -472,19 +460,22 @@ __rooglobal__ void computeGaussian(Batches &batches)
 
 __rooglobal__ void computeIdentity(Batches &batches)
 {
+   Batch x = batches.args[0];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      batches.output[i] = batches.args[0][i];
+      batches.output[i] = x[i];
    }
 }
 
 __rooglobal__ void computeNegativeLogarithms(Batches &batches)
 {
+   Batch probas = batches.args[0];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP)
-      batches.output[i] = -fast_log(batches.args[0][i]);
+      batches.output[i] = -fast_log(probas[i]);
    // Multiply by weights if they exist
    if (batches.extra[0]) {
+      Batch weights = batches.args[1];
       for (size_t i = BEGIN; i < batches.nEvents; i += STEP)
-         batches.output[i] *= batches.args[1][i];
+         batches.output[i] *= weights[i];
    }
 }
 
@@ -720,17 +711,12 @@ __rooglobal__ void computePoisson(Batches &batches)
       const double x_i = noRounding ? x[i] : floor(x[i]);
       const double logMean = fast_log(mean[i]);
       const double logPoisson = x_i * logMean - mean[i] - batches.output[i];
-      batches.output[i] = fast_exp(logPoisson);
+      double result = fast_exp(logPoisson);
 
       // Cosmetics
-      if (x_i < 0) {
-         batches.output[i] = 0;
-      } else if (x_i == 0) {
-         batches.output[i] = 1 / fast_exp(mean[i]);
-      }
-
-      if (protectNegative && mean[i] < 0)
-         batches.output[i] = 1.E-3;
+      result = x_i == 0 ? 1 / fast_exp(mean[i]) : result;
+      result = x_i < 0 ? 0.0 : result;
+      batches.output[i] = protectNegative && mean[i] < 0 ? 1.E-3 : result;
    }
 }
 
@@ -747,8 +733,9 @@ __rooglobal__ void computePolynomial(Batches &batches)
    // Indexes are in range 0..nCoef-1 but coefList[nCoef-1] has already been
    // processed.
    for (int k = nCoef - 2; k >= 0; k--) {
+      Batch coef = batches.args[k];
       for (size_t i = BEGIN; i < nEvents; i += STEP) {
-         batches.output[i] = batches.args[k][i] + x[i] * batches.output[i];
+         batches.output[i] = coef[i] + x[i] * batches.output[i];
       }
    }
 }
@@ -773,29 +760,33 @@ __rooglobal__ void computeProdPdf(Batches &batches)
       batches.output[i] = 1.;
    }
    for (int pdf = 0; pdf < nPdfs; pdf++) {
+      Batch pdfVals = batches.args[pdf];
       for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-         batches.output[i] *= batches.args[pdf][i];
+         batches.output[i] *= pdfVals[i];
       }
    }
 }
 
 __rooglobal__ void computeRatio(Batches &batches)
 {
+   Batch numerator = batches.args[0];
+   Batch denominator = batches.args[1];
    for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      batches.output[i] = batches.args[0][i] / batches.args[1][i];
+      batches.output[i] = numerator[i] / denominator[i];
    }
 }
 
 __rooglobal__ void computeTruthModelExpBasis(Batches &batches)
 {
-
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / batches.args[1][i]);
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / param1[i]);
    }
 }
 
@@ -803,12 +794,14 @@ __rooglobal__ void computeTruthModelSinBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
+   Batch param2 = batches.args[2];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      batches.output[i] =
-         isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / batches.args[1][i]) * fast_sin(x * batches.args[2][i]);
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / param1[i]) * fast_sin(x * param2[i]);
    }
 }
 
@@ -816,12 +809,14 @@ __rooglobal__ void computeTruthModelCosBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
+   Batch param2 = batches.args[2];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      batches.output[i] =
-         isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / batches.args[1][i]) * fast_cos(x * batches.args[2][i]);
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / param1[i]) * fast_cos(x * param2[i]);
    }
 }
 
@@ -829,16 +824,14 @@ __rooglobal__ void computeTruthModelLinBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      if (isOutOfSign) {
-         batches.output[i] = 0.0;
-      } else {
-         const double tscaled = std::abs(x) / batches.args[1][i];
-         batches.output[i] = fast_exp(-tscaled) * tscaled;
-      }
+      const double tscaled = std::abs(x) / param1[i];
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-tscaled) * tscaled;
    }
 }
 
@@ -846,16 +839,14 @@ __rooglobal__ void computeTruthModelQuadBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      if (isOutOfSign) {
-         batches.output[i] = 0.0;
-      } else {
-         const double tscaled = std::abs(x) / batches.args[1][i];
-         batches.output[i] = fast_exp(-tscaled) * tscaled * tscaled;
-      }
+      const double tscaled = std::abs(x) / param1[i];
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-tscaled) * tscaled * tscaled;
    }
 }
 
@@ -863,12 +854,14 @@ __rooglobal__ void computeTruthModelSinhBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
+   Batch param2 = batches.args[2];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      batches.output[i] =
-         isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / batches.args[1][i]) * sinh(x * batches.args[2][i] * 0.5);
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / param1[i]) * sinh(x * param2[i] * 0.5);
    }
 }
 
@@ -876,12 +869,14 @@ __rooglobal__ void computeTruthModelCoshBasis(Batches &batches)
 {
    const bool isMinus = batches.extra[0] < 0.0;
    const bool isPlus = batches.extra[0] > 0.0;
+   Batch X = batches.args[0];
+   Batch param1 = batches.args[1];
+   Batch param2 = batches.args[2];
    for (std::size_t i = BEGIN; i < batches.nEvents; i += STEP) {
-      double x = batches.args[0][i];
+      const double x = X[i];
       // Enforce sign compatibility
       const bool isOutOfSign = (isMinus && x > 0.0) || (isPlus && x < 0.0);
-      batches.output[i] =
-         isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / batches.args[1][i]) * cosh(x * batches.args[2][i] * .5);
+      batches.output[i] = isOutOfSign ? 0.0 : fast_exp(-std::abs(x) / param1[i]) * cosh(x * param2[i] * .5);
    }
 }
 
@@ -25,8 +25,9 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 
 #include <ROOT/RConfig.hxx>
 
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-#include <ROOT/TExecutor.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
 #endif
 
 #include <Math/Util.h>
@@ -75,6 +76,25 @@ inline void advance(Batches &batches, std::size_t nEvents)
    batches.output += nEvents;
 }
 
+/// Number of events in the chunks that are computed by one task in multi-threaded
+/// mode. Arrays with less than two chunks are always computed in the calling thread.
+/// The chunks of the NLL reduction don't depend on the number of threads, such that
+/// the result of a multi-threaded reduction is the same for any number of threads.
+constexpr std::size_t eventsPerTask = 256 * bufferSize;
+
+/// Number of tasks to compute nEvents events, or 1 if they should not be split.
+inline std::size_t nTasks(Config const &cfg, std::size_t nEvents)
+{
+#ifdef R__USE_IMT
+   if (cfg.threadExecutor() && nEvents >= 2 * eventsPerTask)
+      return (nEvents + eventsPerTask - 1) / eventsPerTask;
+#else
+   (void)cfg;
+   (void)nEvents;
+#endif
+   return 1;
+}
+
 } // namespace
 
 std::vector<void (*)(Batches &)> getFunctions();
@@ -125,117 +145,79 @@ public:
    bool cudaStreamIsActive(CudaInterface::CudaStream *) const override { throw std::bad_function_call(); }
 
 private:
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-   void computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs);
-#endif
+   void computeRange(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs,
+                     std::size_t begin, std::size_t end);
 
    const std::vector<void (*)(Batches &)> _computeFunctions;
 };
 
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs)
+/// Compute the events in [begin, end) in batches of bufferSize events.
+void RooBatchComputeClass::computeRange(Computer computer, std::span<double> output, VarSpan vars,
+                                        ArgSpan extraArgs, std::size_t begin, std::size_t end)
 {
-   std::size_t nEvents = output.size();
-
-   if (nEvents == 0)
-      return;
-   ROOT::Internal::TExecutor ex;
-   std::size_t nThreads = ex.GetPoolSize();
-
-   std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
-
-   // Reset the number of threads to the number we actually need given nEventsPerThread
-   nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
-
-   auto task = [&](std::size_t idx) -> int {
-      // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-      // Then advance every object but the first to split the work between threads
-      Batches batches;
-      std::vector<Batch> arrays(vars.size());
-      fillBatches(batches, output.data(), nEventsPerThread, vars.size(), extraArgs);
-      fillArrays(arrays, vars, nEvents);
-      batches.args = arrays.data();
-      advance(batches, batches.nEvents * idx);
-
-      // Set the number of events of the last Batches object as the remaining events
-      if (idx == nThreads - 1) {
-         batches.nEvents = nEvents - idx * batches.nEvents;
-      }
+   Batches batches;
+   std::vector<Batch> arrays(vars.size());
+   fillBatches(batches, output.data(), end - begin, vars.size(), extraArgs);
+   fillArrays(arrays, vars, output.size());
+   batches.args = arrays.data();
+   advance(batches, begin);
 
-      std::size_t events = batches.nEvents;
-      batches.nEvents = bufferSize;
-      while (events > bufferSize) {
-         _computeFunctions[computer](batches);
-         advance(batches, bufferSize);
-         events -= bufferSize;
-      }
-      batches.nEvents = events;
+   std::size_t events = batches.nEvents;
+   batches.nEvents = bufferSize;
+   while (events > bufferSize) {
       _computeFunctions[computer](batches);
-      return 0;
-   };
-
-   std::vector<std::size_t> indices(nThreads);
-   for (unsigned int i = 1; i < nThreads; i++) {
-      indices[i] = i;
+      advance(batches, bufferSize);
+      events -= bufferSize;
    }
-   ex.Map(task, indices);
+   batches.nEvents = events;
+   _computeFunctions[computer](batches);
 }
-#endif
 
 /** Compute multiple values using optimized functions.
 This method creates a Batches object and passes it to the correct compute function.
-In case Implicit Multithreading is enabled, the events to be processed are equally
-divided among the tasks to be generated and computed in parallel.
+If the configuration asks for more than one thread, large arrays are split in chunks
+of events that are computed in parallel by a ROOT::TThreadExecutor.
+\param cfg The configuration of the computation, e.g. the number of threads.
 \param computer An enum specifying the compute function to be used.
 \param output The array where the computation results are stored.
 \param vars A std::span containing pointers to the variables involved in the computation.
 \param extraArgs An optional std::span containing extra double values that may participate in the computation. **/
-void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<double> output, VarSpan vars,
+void RooBatchComputeClass::compute(Config const &cfg, Computer computer, std::span<double> output, VarSpan vars,
                                    ArgSpan extraArgs)
 {
    // In the original implementation of this library, the evaluation was done
-   // multi-threaded in implicit multi-threading was enabled in ROOT with
-   // ROOT::EnableImplicitMT().
-   //
-   // However, this multithreaded mode was not carefully validated and is
-   // therefore not production ready. One would first have to study the
-   // overhead for different numbers of cores, number of events, and model
-   // complexity. The, we should only consider implicit multithreading here if
-   // there is no performance penalty for any scenario, to not surprise the
-   // users with unexpected slowdows!
-   //
-   // Note that the priority of investigating this is not high, because RooFit
-   // R & D efforts currently go in the direction of parallelization at the
-   // level of the gradient components, or achieving single-threaded speedup
-   // with automatic differentiation. Furthermore, the single-threaded
-   // performance of the new CPU evaluation backend with the RooBatchCompute
-   // library, is generally much faster than the legacy evaluation backend
-   // already, even if the latter uses multi-threading.
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-   if (ROOT::IsImplicitMTEnabled()) {
-      computeIMT(computer, output, vars, extraArgs);
+   // multi-threaded if implicit multi-threading was enabled in ROOT with
+   // ROOT::EnableImplicitMT(). To not surprise the users with unexpected
+   // slowdowns for small datasets or with oversubscription, the computation is
+   // now only split if multiple threads are explicitly requested in the
+   // configuration, which the Evaluator does for NumCPU(n) in the cpu backend.
+   // The thread pool is created once by the Evaluator and passed in the configuration.
+   const std::size_t nEvents = output.size();
+   const std::size_t nChunks = nTasks(cfg, nEvents);
+
+   if (nChunks == 1) {
+      computeRange(computer, output, vars, extraArgs, 0, nEvents);
+      return;
    }
-#endif
-
-   std::size_t nEvents = output.size();
-
-   // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-   // Then advance every object but the first to split the work between threads
-   Batches batches;
-   std::vector<Batch> arrays(vars.size());
-   fillBatches(batches, output.data(), nEvents, vars.size(), extraArgs);
-   fillArrays(arrays, vars, nEvents);
-   batches.args = arrays.data();
 
-   std::size_t events = batches.nEvents;
-   batches.nEvents = bufferSize;
-   while (events > bufferSize) {
-      _computeFunctions[computer](batches);
-      advance(batches, bufferSize);
-      events -= bufferSize;
+#ifdef R__USE_IMT
+   // Some compute functions write to the extra arguments, e.g. to count
+   // evaluation errors. Every chunk gets its own copy of them, and the changes
+   // are added back in the order of the chunks.
+   const std::vector<double> extraArgsIn(extraArgs.begin(), extraArgs.end());
+   std::vector<std::vector<double>> extraArgsPerChunk(nChunks, extraArgsIn);
+   cfg.threadExecutor()->Foreach(
+      [&](std::size_t iChunk) {
+         computeRange(computer, output, vars, extraArgsPerChunk[iChunk], iChunk * eventsPerTask,
+                      std::min(nEvents, (iChunk + 1) * eventsPerTask));
+      },
+      ROOT::TSeq<std::size_t>(nChunks));
+   for (std::vector<double> const &chunkExtraArgs : extraArgsPerChunk) {
+      for (std::size_t i = 0; i < extraArgs.size(); ++i) {
+         extraArgs[i] += chunkExtraArgs[i] - extraArgsIn[i];
+      }
    }
-   batches.nEvents = events;
-   _computeFunctions[computer](batches);
+#endif
 }
 
 namespace {
@@ -266,16 +248,23 @@ double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
    return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
 }
 
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
-                                                std::span<const double> weights, std::span<const double> offsetProbas)
-{
-   ReduceNLLOutput out;
+namespace {
 
+/// Partial sum of the negative log-likelihood over a range of events.
+struct NLLPartialSum {
+   ReduceNLLOutput out;
+   ROOT::Math::KahanSum<double> nllSum;
    double badness = 0.0;
+};
 
-   ROOT::Math::KahanSum<double> nllSum;
+void addNLLTerms(NLLPartialSum &partial, std::span<const double> probas, std::span<const double> weights,
+                 std::span<const double> offsetProbas, std::size_t begin, std::size_t end)
+{
+   ReduceNLLOutput &out = partial.out;
+   ROOT::Math::KahanSum<double> &nllSum = partial.nllSum;
+   double &badness = partial.badness;
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weights.size() > 1 ? weights[i] : weights[0];
 
@@ -294,6 +283,45 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const
 
       nllSum.Add(term);
    }
+}
+
+} // namespace
+
+/// Sum the negative log probabilities. If the configuration asks for more than
+/// one thread, large arrays are split in chunks of fixed size that are summed in
+/// parallel, and the partial sums are added in the order of the chunks. The
+/// result therefore doesn't depend on the number of threads or on the scheduling.
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &cfg, std::span<const double> probas,
+                                                std::span<const double> weights, std::span<const double> offsetProbas)
+{
+   const std::size_t nEvents = probas.size();
+   const std::size_t nChunks = nTasks(cfg, nEvents);
+
+   NLLPartialSum total;
+   if (nChunks == 1) {
+      addNLLTerms(total, probas, weights, offsetProbas, 0, nEvents);
+   } else {
+#ifdef R__USE_IMT
+      std::vector<NLLPartialSum> partials(nChunks);
+      cfg.threadExecutor()->Foreach(
+         [&](std::size_t iChunk) {
+            addNLLTerms(partials[iChunk], probas, weights, offsetProbas, iChunk * eventsPerTask,
+                        std::min(nEvents, (iChunk + 1) * eventsPerTask));
+         },
+         ROOT::TSeq<std::size_t>(nChunks));
+      for (NLLPartialSum const &partial : partials) {
+         total.nllSum += partial.nllSum;
+         total.badness += partial.badness;
+         total.out.nLargeValues += partial.out.nLargeValues;
+         total.out.nNonPositiveValues += partial.out.nNonPositiveValues;
+         total.out.nNaNValues += partial.out.nNaNValues;
+      }
+#endif
+   }
+
+   ReduceNLLOutput out = total.out;
+   ROOT::Math::KahanSum<double> const &nllSum = total.nllSum;
+   double const badness = total.badness;
 
    out.nllSum = nllSum.Sum();
    out.nllSumCarry = nllSum.Carry();
@@ -0,0 +1,177 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+// Benchmark of the cpu computation functions of the RooBatchCompute library.
+//
+// The library that RooBatchCompute::initCPU() selects for this machine, e.g.
+// the AVX2 variant, is compared with the generic library, which is compiled
+// without flags for vector instructions. For every computation function and
+// batch size, the time per event of both libraries and the largest relative
+// difference of the results are printed.
+//
+// Usage: benchRooBatchCompute [number of events per measurement]
+
+#include <RooBatchCompute.h>
+
+#include <TSystem.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using RooBatchCompute::bufferSize;
+using RooBatchCompute::Computer;
+using RooBatchCompute::RooBatchComputeInterface;
+
+namespace {
+
+struct Kernel {
+   std::string name;
+   Computer computer;
+   std::vector<std::vector<double>> vars;
+   std::vector<double> extra;
+};
+
+std::mt19937 randomEngine{1234};
+
+/// Observable with one value per event, uniformly distributed in [lo, hi).
+std::vector<double> observable(std::size_t nEvents, double lo, double hi)
+{
+   std::uniform_real_distribution<double> dist{lo, hi};
+   std::vector<double> out(nEvents);
+   std::generate(out.begin(), out.end(), [&]() { return dist(randomEngine); });
+   return out;
+}
+
+/// Parameter, which is passed to the library as a buffer with the same value
+/// for all events of a batch, like in the RooFit::Evaluator.
+std::vector<double> parameter(double val)
+{
+   return std::vector<double>(bufferSize, val);
+}
+
+std::vector<Kernel> makeKernels(std::size_t n)
+{
+   std::vector<Kernel> kernels;
+   kernels.push_back({"AddPdf",
+                      Computer::AddPdf,
+                      {observable(n, 0., 1.), observable(n, 0., 1.), observable(n, 0., 1.)},
+                      {0.2, 0.3, 0.5}});
+   kernels.push_back({"ArgusBG",
+                      Computer::ArgusBG,
+                      {observable(n, 5.2, 5.3), parameter(5.29), parameter(-20.), parameter(0.5)},
+                      {}});
+   kernels.push_back({"Bernstein", Computer::Bernstein, {observable(n, 0., 1.)}, {0.5, 0.3, 0.8, 0.4, 0.6, 0., 1.}});
+   kernels.push_back({"BifurGauss",
+                      Computer::BifurGauss,
+                      {observable(n, -5., 5.), parameter(0.3), parameter(1.2), parameter(2.)},
+                      {}});
+   kernels.push_back({"CBShape",
+                      Computer::CBShape,
+                      {observable(n, 5.2, 5.3), parameter(5.28), parameter(0.01), parameter(1.5), parameter(3.)},
+                      {}});
+   kernels.push_back({"Chebychev", Computer::Chebychev, {observable(n, -1., 1.)}, {0.3, -0.2, 0.1, 0.05, -1., 1.}});
+   kernels.push_back({"Exponential", Computer::Exponential, {observable(n, 0., 10.), parameter(-0.5)}, {}});
+   kernels.push_back(
+      {"Gaussian", Computer::Gaussian, {observable(n, -5., 5.), parameter(0.3), parameter(1.2)}, {}});
+   kernels.push_back({"Landau", Computer::Landau, {observable(n, -5., 50.), parameter(1.), parameter(2.)}, {}});
+   kernels.push_back(
+      {"NormalizedPdf", Computer::NormalizedPdf, {observable(n, 0., 1.), parameter(2.)}, {0., 0., 0.}});
+   kernels.push_back({"Poisson", Computer::Poisson, {observable(n, 0., 20.), parameter(7.5)}, {0., 0.}});
+   kernels.push_back({"Polynomial",
+                      Computer::Polynomial,
+                      {parameter(1.), parameter(0.5), parameter(-0.2), parameter(0.1), observable(n, -1., 1.)},
+                      {4.}});
+   kernels.push_back({"ProdPdf",
+                      Computer::ProdPdf,
+                      {observable(n, 0., 1.), observable(n, 0., 1.), observable(n, 0., 1.)},
+                      {3.}});
+   kernels.push_back(
+      {"TruthModelExpBasis", Computer::TruthModelExpBasis, {observable(n, -5., 5.), parameter(1.5)}, {1.}});
+   return kernels;
+}
+
+/// Compute the kernel on the first nEvents events, and return the time per event in nanoseconds.
+double timePerEvent(RooBatchComputeInterface &library, Kernel &kernel, std::size_t nEvents, std::size_t nTotal,
+                    std::vector<double> &output)
+{
+   std::vector<std::span<const double>> vars;
+   for (auto const &var : kernel.vars) {
+      vars.emplace_back(var.data(), var.size() == bufferSize ? bufferSize : nEvents);
+   }
+   output.resize(nEvents);
+
+   RooBatchCompute::Config cfg;
+   const std::size_t nRepetitions = std::max<std::size_t>(1, nTotal / nEvents);
+
+   // one evaluation to warm up the caches
+   library.compute(cfg, kernel.computer, output, vars, kernel.extra);
+
+   const auto start = std::chrono::steady_clock::now();
+   for (std::size_t i = 0; i < nRepetitions; ++i) {
+      library.compute(cfg, kernel.computer, output, vars, kernel.extra);
+   }
+   const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+   return duration.count() / (nRepetitions * nEvents);
+}
+
+double maxRelativeDifference(std::vector<double> const &a, std::vector<double> const &b)
+{
+   double out = 0.;
+   for (std::size_t i = 0; i < a.size(); ++i) {
+      if (std::isnan(a[i]) && std::isnan(b[i]))
+         continue;
+      out = std::max(out, std::abs(a[i] - b[i]) / std::max(std::abs(a[i]), 1e-300));
+   }
+   return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+   const std::size_t nTotal = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+   RooBatchCompute::initCPU();
+   RooBatchComputeInterface *best = RooBatchCompute::dispatchCPU;
+
+   // Loading another variant of the library sets the dispatch pointer to it.
+   RooBatchComputeInterface *generic = best;
+   if (best->architecture() != RooBatchCompute::Architecture::GENERIC) {
+      gSystem->Load("libRooBatchCompute_GENERIC");
+      generic = RooBatchCompute::dispatchCPU;
+      RooBatchCompute::dispatchCPU = best;
+   }
+
+   const std::size_t maxEvents = 1024 * bufferSize;
+   std::vector<Kernel> kernels = makeKernels(maxEvents);
+
+   std::printf("%-20s %10s %12s %12s %8s %10s\n", "function", "events", generic->architectureName().c_str(),
+               best->architectureName().c_str(), "speedup", "max rel diff");
+   std::printf("%-20s %10s %12s %12s\n", "", "", "[ns/event]", "[ns/event]");
+
+   std::vector<double> outGeneric;
+   std::vector<double> outBest;
+   for (Kernel &kernel : kernels) {
+      for (std::size_t nEvents : {bufferSize, 16 * bufferSize, maxEvents}) {
+         const double tGeneric = timePerEvent(*generic, kernel, nEvents, nTotal, outGeneric);
+         const double tBest = timePerEvent(*best, kernel, nEvents, nTotal, outBest);
+         std::printf("%-20s %10zu %12.3f %12.3f %8.2f %10.1e\n", kernel.name.c_str(), nEvents, tGeneric, tBest,
+                     tGeneric / tBest, maxRelativeDifference(outGeneric, outBest));
+      }
+   }
+
+   return 0;
+}
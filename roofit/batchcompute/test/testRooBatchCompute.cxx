@@ -0,0 +1,228 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooBatchCompute.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <span>
+#include <sstream>
+#include <vector>
+
+using RooBatchCompute::Computer;
+
+namespace {
+
+/// Compute a function with the library that RooBatchCompute::initCPU() selects,
+/// with one value per event for every argument.
+std::vector<double> compute(Computer computer, std::vector<std::vector<double>> const &args,
+                            std::vector<double> extra = {})
+{
+   RooBatchCompute::initCPU();
+   std::vector<std::span<const double>> vars(args.begin(), args.end());
+   std::vector<double> output(args[0].size());
+   RooBatchCompute::Config cfg;
+   RooBatchCompute::dispatchCPU->compute(cfg, computer, output, vars, extra);
+   return output;
+}
+
+/// Compare the results of the library with the reference values, relative to the reference.
+void expectNear(std::vector<double> const &result, std::vector<double> const &reference,
+                std::vector<std::vector<double>> const &args)
+{
+   ASSERT_EQ(result.size(), reference.size());
+   for (std::size_t i = 0; i < result.size(); ++i) {
+      std::stringstream point;
+      for (auto const &arg : args) {
+         point << arg[i] << " ";
+      }
+      EXPECT_NEAR(result[i], reference[i], 1e-10 * std::abs(reference[i])) << "at event " << i << ": " << point.str();
+   }
+}
+
+std::mt19937 randomEngine{1234};
+
+/// Values uniformly distributed in [lo, hi).
+std::vector<double> uniform(std::size_t n, double lo, double hi)
+{
+   std::uniform_real_distribution<double> dist{lo, hi};
+   std::vector<double> out(n);
+   for (double &val : out) {
+      val = dist(randomEngine);
+   }
+   return out;
+}
+
+constexpr std::size_t nEvents = 1000;
+
+} // namespace
+
+// Validate the branch-free kernels against the previous implementations, which branched per event, for random inputs
+// and on the boundaries between the branches.
+
+TEST(RooBatchCompute, ArgusBG)
+{
+   std::vector<std::vector<double>> args{uniform(nEvents, 5.2, 5.3), uniform(nEvents, 5.25, 5.29),
+                                         uniform(nEvents, -30., -10.), uniform(nEvents, 0.2, 1.)};
+   // on the end point
+   args[0][0] = args[1][0];
+
+   std::vector<double> reference(nEvents);
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double m = args[0][i], m0 = args[1][i], c = args[2][i], p = args[3][i];
+      const double t = m / m0;
+      const double u = 1 - t * t;
+      reference[i] = m >= m0 ? 0.0 : m * std::exp(c * u + p * std::log(u));
+   }
+   expectNear(compute(Computer::ArgusBG, args), reference, args);
+}
+
+TEST(RooBatchCompute, Bukin)
+{
+   std::vector<std::vector<double>> args{uniform(nEvents, -5., 5.),  uniform(nEvents, -0.5, 0.5),
+                                         uniform(nEvents, 0.5, 1.5), uniform(nEvents, -0.5, 0.5),
+                                         uniform(nEvents, -0.1, 0.), uniform(nEvents, -0.1, 0.)};
+   const double r3 = std::log(2.0);
+   const double r6 = std::exp(-6.0);
+   const double r7 = 2 * std::sqrt(2 * std::log(2.0));
+
+   // asymmetry parameters around the threshold of the Gaussian core
+   for (std::size_t i = 0; i < 100; ++i) {
+      args[3][i] = (i % 2 ? 1 : -1) * r6 * (0.5 + 0.01 * i);
+   }
+   // on the edges between core and tails
+   for (std::size_t i = 100; i < 110; ++i) {
+      const double r1 = args[3][i] / std::sqrt(args[3][i] * args[3][i] + 1);
+      args[0][i] = args[1][i] + 0.5 * args[2][i] * r7 * (r1 + (i % 2 ? 1 : -1));
+   }
+
+   std::vector<double> reference(nEvents);
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double x = args[0][i], xp = args[1][i], sp = args[2][i], xi = args[3][i];
+      const double r1 = xi / std::sqrt(xi * xi + 1);
+      const double r4 = std::sqrt(xi * xi + 1);
+      const double hp = 1 / (sp * r7);
+      const double x1 = xp + 0.5 * sp * r7 * (r1 - 1);
+      const double x2 = xp + 0.5 * sp * r7 * (r1 + 1);
+
+      double r5 = 1.0;
+      if (xi > r6 || xi < -r6)
+         r5 = xi / std::log(r4 + xi);
+
+      double factor = 1;
+      double y = x - x1;
+      double Yp = xp - x1;
+      double yi = r4 - xi;
+      double rho = args[4][i];
+      if (x >= x2) {
+         factor = -1;
+         y = x - x2;
+         Yp = xp - x2;
+         yi = r4 + xi;
+         rho = args[5][i];
+      }
+
+      double out = rho * y * y / Yp / Yp - r3 + factor * 4 * r3 * y * hp * r5 * r4 / yi / yi;
+      if (x >= x1 && x < x2) {
+         out = std::log(1 + 4 * xi * r4 * (x - xp) * hp) / std::log(1 + 2 * xi * (xi - r4));
+         out *= -out * r3;
+      }
+      if (x >= x1 && x < x2 && xi < r6 && xi > -r6)
+         out = -4 * r3 * (x - xp) * (x - xp) * hp * hp;
+      reference[i] = std::exp(out);
+   }
+   expectNear(compute(Computer::Bukin, args), reference, args);
+}
+
+TEST(RooBatchCompute, CBShape)
+{
+   std::vector<std::vector<double>> args{uniform(nEvents, 5.2, 5.3), uniform(nEvents, 5.27, 5.29),
+                                         uniform(nEvents, 0.005, 0.02), uniform(nEvents, -3., 3.),
+                                         uniform(nEvents, 1.5, 10.)};
+   // on the edge between core and tail, for both signs of alpha
+   for (std::size_t i = 0; i < 10; ++i) {
+      args[3][i] = i % 2 ? 1.5 : -1.5;
+      args[0][i] = args[1][i] - std::abs(args[3][i]) * args[2][i] * (args[3][i] > 0 ? 1 : -1);
+   }
+
+   std::vector<double> reference(nEvents);
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double m = args[0][i], m0 = args[1][i], s = args[2][i], a = args[3][i], n = args[4][i];
+      const double t = (m - m0) / s;
+      if ((a > 0 && t >= -a) || (a < 0 && -t >= a)) {
+         reference[i] = std::exp(-0.5 * t * t);
+      } else {
+         reference[i] = std::exp(n * std::log(n / (n - a * a - a * t)) - 0.5 * a * a);
+      }
+   }
+   expectNear(compute(Computer::CBShape, args), reference, args);
+}
+
+TEST(RooBatchCompute, Gamma)
+{
+   std::vector<std::vector<double>> args{uniform(nEvents, 0., 20.), uniform(nEvents, 0.5, 5.),
+                                         uniform(nEvents, 0.5, 3.), uniform(nEvents, -1., 0.)};
+   // at the position parameter, with gamma = 1 and gamma != 1
+   for (std::size_t i = 0; i < 10; ++i) {
+      args[0][i] = args[3][i];
+      args[1][i] = i % 2 ? 1. : args[1][i];
+   }
+
+   std::vector<double> reference(nEvents);
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double x = args[0][i], gamma = args[1][i], beta = args[2][i], mu = args[3][i];
+      if (x == mu) {
+         reference[i] = (gamma == 1.0) / beta;
+      } else {
+         const double arg = (x - mu) / beta;
+         reference[i] = std::exp(-std::lgamma(gamma) - arg + std::log(arg) * (gamma - 1)) / beta;
+      }
+   }
+   expectNear(compute(Computer::Gamma, args), reference, args);
+}
+
+TEST(RooBatchCompute, Poisson)
+{
+   std::vector<std::vector<double>> args{uniform(nEvents, -2., 30.), uniform(nEvents, -1., 20.)};
+   // integer and zero counts
+   for (std::size_t i = 0; i < 20; ++i) {
+      args[0][i] = i % 2 ? 0. : std::floor(args[0][i]);
+   }
+
+   for (bool protectNegative : {false, true}) {
+      for (bool noRounding : {false, true}) {
+         std::vector<double> reference(nEvents);
+         for (std::size_t i = 0; i < nEvents; ++i) {
+            const double x = noRounding ? args[0][i] : std::floor(args[0][i]);
+            const double mean = args[1][i];
+            double out = std::exp(x * std::log(mean) - mean - std::lgamma(x + 1.));
+            if (x < 0) {
+               out = 0;
+            } else if (x == 0) {
+               out = 1 / std::exp(mean);
+            }
+            if (protectNegative && mean < 0)
+               out = 1.E-3;
+            reference[i] = out;
+         }
+         std::vector<double> result = compute(Computer::Poisson, args, {double(protectNegative), double(noRounding)});
+         for (std::size_t i = 0; i < nEvents; ++i) {
+            // the logarithm of a negative mean is NaN in both implementations
+            if (std::isnan(reference[i])) {
+               EXPECT_TRUE(std::isnan(result[i])) << "at event " << i;
+               reference[i] = result[i] = 0.;
+            }
+         }
+         expectNear(result, reference, args);
+      }
+   }
+}
@@ -42,6 +42,53 @@
 
 using std::endl, std::cout;
 
+namespace {
+
+/// For the interpolation codes 0, 2, 3 and 4, the contribution of a parameter
+/// to a bin is linear in the variations `high - nominal` and `nominal - low`,
+/// with coefficients that only depend on the parameter value. This function
+/// computes these coefficients like flexibleInterpSingle() with boundary 1.0,
+/// so the loop over the bins doesn't need to branch. Returns false for the
+/// other codes.
+bool additiveInterpCoefs(int code, double x, double &cHigh, double &cLow)
+{
+   switch (code) {
+   case 0:
+      cHigh = x > 0 ? x : 0.;
+      cLow = x > 0 ? 0. : x;
+      return true;
+   case 2:
+   case 3:
+      if (x > 1) {
+         cHigh = 1.5 * (x - 1) + 1;
+         cLow = -0.5 * (x - 1);
+      } else if (x < -1) {
+         cHigh = -0.5 * (x + 1);
+         cLow = 1.5 * (x + 1) - 1;
+      } else {
+         cHigh = 0.5 * (x * x + x);
+         cLow = 0.5 * (x - x * x);
+      }
+      return true;
+   case 4:
+      if (x >= 1) {
+         cHigh = x;
+         cLow = 0.;
+      } else if (x <= -1) {
+         cHigh = 0.;
+         cLow = x;
+      } else {
+         const double tA = 0.0625 * x * (15 + x * x * (-10 + x * x * 3));
+         cHigh = x * (0.5 + tA);
+         cLow = x * (0.5 - tA);
+      }
+      return true;
+   default: return false;
+   }
+}
+
+} // namespace
+
 ClassImp(PiecewiseInterpolation);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -275,6 +322,16 @@ void PiecewiseInterpolation::doEval(RooFit::EvalContext & ctx) const
       throw std::invalid_argument("PiecewiseInterpolation::doEval() got invalid interpolation code " + std::to_string(icode));
     }
 
+    double cHigh = 0.;
+    double cLow = 0.;
+    if (additiveInterpCoefs(icode, param, cHigh, cLow)) {
+      if (cHigh == 0. && cLow == 0.) continue;
+      for (unsigned int j=0; j < nominal.size(); ++j) {
+        sum[j] += cHigh * (high[j] - nominal[j]) + cLow * (nominal[j] - low[j]);
+      }
+      continue;
+    }
+
     for (unsigned int j=0; j < nominal.size(); ++j) {
        using RooFit::Detail::MathFuncs::flexibleInterpSingle;
        sum[j] += flexibleInterpSingle(icode, low[j], high[j], 1.0, nominal[j], param, sum[j]);
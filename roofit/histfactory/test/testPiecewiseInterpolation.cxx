@@ -0,0 +1,78 @@
+// Tests for the PiecewiseInterpolation
+
+#include <RooArgSet.h>
+#include <RooDataHist.h>
+#include <RooHistFunc.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+#include <RooStats/HistFactory/PiecewiseInterpolation.h>
+#include <RooFit/Detail/NormalizationHelpers.h>
+#include <RooFit/Evaluator.h>
+
+#include "RooFit/Detail/BatchModeDataHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stack>
+
+/// Validate the BatchMode implementation of the PiecewiseInterpolation against
+/// the scalar implementation, for all interpolation codes and for parameter
+/// values inside and outside of the [-1, 1] interval.
+TEST(PiecewiseInterpolation, BatchModeAllInterpCodes)
+{
+   const int nBins = 20;
+
+   RooRealVar x{"x", "x", 0, nBins};
+   x.setBins(nBins);
+
+   RooDataHist dhNominal{"dhNominal", "dhNominal", x};
+   RooDataHist dhLow{"dhLow", "dhLow", x};
+   RooDataHist dhHigh{"dhHigh", "dhHigh", x};
+   for (int i = 0; i < nBins; ++i) {
+      const double nominal = 100. + 50. * RooRandom::uniform();
+      dhNominal.set(i, nominal, -1);
+      dhLow.set(i, nominal * (0.8 + 0.1 * RooRandom::uniform()), -1);
+      dhHigh.set(i, nominal * (1.1 + 0.1 * RooRandom::uniform()), -1);
+   }
+
+   RooHistFunc nominal{"nominal", "nominal", x, dhNominal};
+   RooHistFunc low{"low", "low", x, dhLow};
+   RooHistFunc high{"high", "high", x, dhHigh};
+
+   RooRealVar alpha1{"alpha1", "alpha1", 0., -5., 5.};
+   RooRealVar alpha2{"alpha2", "alpha2", 0., -5., 5.};
+
+   // The same variations for both parameters, so each one contributes to the sum
+   PiecewiseInterpolation interp{"interp", "interp", nominal, {low, low}, {high, high}, {alpha1, alpha2}};
+
+   for (int code = 0; code <= 5; ++code) {
+      interp.setAllInterpCodes(code);
+      for (double val1 : {-2.5, -1.0, -0.3, 0.0, 0.6, 1.0, 1.7}) {
+         alpha1.setVal(val1);
+         alpha2.setVal(-0.5 * val1);
+
+         std::vector<double> resultsScalar(nBins);
+         for (int i = 0; i < nBins; ++i) {
+            x.setVal(dhNominal.get(i)->getRealValue("x"));
+            resultsScalar[i] = interp.getVal();
+         }
+
+         std::unique_ptr<RooAbsReal> clone = RooFit::Detail::compileForNormSet<RooAbsReal>(interp, x);
+         RooFit::Evaluator evaluator(*clone);
+         std::stack<std::vector<double>> vectorBuffers;
+         auto dataSpans = RooFit::Detail::BatchModeDataHelpers::getDataSpans(
+            dhNominal, "", nullptr, /*skipZeroWeights=*/false, /*takeGlobalObservablesFromData=*/false,
+            vectorBuffers);
+         for (auto const &item : dataSpans) {
+            evaluator.setInput(item.first->GetName(), item.second, false);
+         }
+         std::span<const double> resultsBatch = evaluator.run();
+
+         for (int i = 0; i < nBins; ++i) {
+            EXPECT_NEAR(resultsBatch[i], resultsScalar[i], 1e-10 * std::abs(resultsScalar[i]))
+               << "code " << code << ", alpha1 " << val1 << ", bin " << i;
+         }
+      }
+   }
+}
@@ -337,8 +337,9 @@ public:
   static void logEvalError(const RooAbsReal* originator, const char* origName, const char* message, const char* serverValueString=nullptr) ;
   static void printEvalErrors(std::ostream&os=std::cout, Int_t maxPerNode=10000000) ;
   static Int_t numEvalErrors() ;
-  inline static Int_t numEvalErrorItems() { return _evalErrorList.size(); }
+  static Int_t numEvalErrorItems() ;
 
+  /// Iterator over the logged errors. Must not be used while errors are logged concurrently.
   inline static auto evalErrorIter() { return _evalErrorList.begin(); }
 
   static void clearEvalErrorLog() ;
@@ -41,7 +41,8 @@ namespace Detail {
 /// @brief A class to maintain the context for squashing of RooFit models into code.
 class CodeSquashContext {
 public:
-   CodeSquashContext(std::map<RooFit::Detail::DataKey, std::size_t> const &outputSizes, std::vector<double> &xlarr, Experimental::RooFuncWrapper &wrapper);
+   CodeSquashContext(std::map<RooFit::Detail::DataKey, std::size_t> const &outputSizes, std::vector<double> &xlarr,
+                     Experimental::RooFuncWrapper &wrapper, bool exportable = false);
 
    void addResult(RooAbsArg const *key, std::string const &value);
    void addResult(const char *key, std::string const &value);
@@ -112,6 +113,8 @@ public:
    std::string buildArg(std::span<const double> arr);
    std::string buildArg(std::span<const int> arr) { return buildArgSpanImpl(arr); }
 
+   std::string buildDataIndex(std::size_t value);
+
    Experimental::RooFuncWrapper *_wrapper = nullptr;
 
 private:
@@ -170,8 +173,13 @@ private:
    std::unordered_map<const TNamed *, std::string> _nodeNames;
    /// @brief Block of code that is placed before the rest of the function body.
    std::string _globalScope;
+   /// @brief The expressions of the start index and of the number of entries of the non scalar observables.
+   struct VecObsInfo {
+      std::string idx;
+      std::string size;
+   };
    /// @brief A map to keep track of the observable indices if they are non scalar.
-   std::unordered_map<const TNamed *, int> _vecObsIndices;
+   std::unordered_map<const TNamed *, VecObsInfo> _vecObsIndices;
    /// @brief Map of node output sizes.
    std::map<RooFit::Detail::DataKey, std::size_t> _nodeOutputSizes;
    /// @brief Stores the squashed code body.
@@ -188,6 +196,8 @@ private:
    /// @brief A map to keep track of list names as assigned by addResult.
    std::unordered_map<RooFit::UniqueId<RooAbsCollection>::Value_t, std::string> listNames;
    std::vector<double> &_xlArr;
+   /// @brief Whether the code must not depend on the data, see buildDataIndex().
+   bool _exportable = false;
 };
 
 template <>
@@ -25,6 +25,10 @@
 class ChangeOperModeRAII;
 class RooAbsArg;
 
+namespace ROOT {
+class TThreadExecutor;
+}
+
 namespace RooBatchCompute {
 class AbsBufferManager;
 }
@@ -44,6 +48,7 @@ public:
    void print(std::ostream &os);
 
    void setOffsetMode(RooFit::EvalContext::OffsetMode);
+   void setNThreads(std::size_t nThreads);
 
 private:
    void processVariable(NodeInfo &nodeInfo);
@@ -65,6 +70,7 @@ private:
    RooFit::EvalContext _evalContextCUDA;
    std::vector<NodeInfo> _nodes; // the ordered computation graph
    std::stack<std::unique_ptr<ChangeOperModeRAII>> _changeOperModeRAIIs;
+   std::shared_ptr<ROOT::TThreadExecutor> _threadExecutor; // shared with the configurations of the CPU nodes
 };
 
 } // end namespace RooFit
@@ -33,7 +33,7 @@ namespace TestStatistics {
 class RooAbsL;
 struct WrapperCalculationCleanFlags;
 
-enum class LikelihoodGradientMode { multiprocess };
+enum class LikelihoodGradientMode { multiprocess, serial };
 
 class LikelihoodGradientWrapper {
 protected:
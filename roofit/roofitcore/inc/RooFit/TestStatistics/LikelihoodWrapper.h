@@ -50,7 +50,7 @@ struct WrapperCalculationCleanFlags {
 
 enum class LikelihoodType { unbinned, binned, subsidiary, sum };
 
-enum class LikelihoodMode { serial, multiprocess };
+enum class LikelihoodMode { serial, multiprocess, multithreadComponents };
 
 /// Previously, offsetting was only implemented for RooNLLVar components of a likelihood,
 /// not for RooConstraintSum terms. To emulate this behavior, use OffsettingMode::legacy. To
@@ -70,7 +70,7 @@ public:
 
    static std::unique_ptr<LikelihoodWrapper> create(LikelihoodMode likelihoodMode, std::shared_ptr<RooAbsL> likelihood,
                                                     std::shared_ptr<WrapperCalculationCleanFlags> calculationIsClean,
-                                                    SharedOffset offset);
+                                                    SharedOffset offset, std::size_t nThreads = 0);
 
    /// \brief Triggers (possibly asynchronous) evaluation of the likelihood
    ///
@@ -34,7 +34,8 @@ namespace Experimental {
 class RooFuncWrapper final : public RooAbsReal {
 public:
    RooFuncWrapper(const char *name, const char *title, RooAbsReal &obj, const RooAbsData *data = nullptr,
-                  RooSimultaneous const *simPdf = nullptr, bool useEvaluator = false);
+                  RooSimultaneous const *simPdf = nullptr, bool useEvaluator = false,
+                  std::string const &libraryDirectory = {});
 
    RooFuncWrapper(const RooFuncWrapper &other, const char *name = nullptr);
 
@@ -64,6 +65,11 @@ public:
 
    std::string buildCode(RooAbsReal const &head);
 
+   /// Hash of the generated code, which identifies the compiled library of this function.
+   std::string const &codeHash() const { return _codeHash; }
+
+   bool exportLibrary(std::string const &directory) const;
+
 protected:
    double evaluate() const override;
 
@@ -77,6 +83,9 @@ private:
 
    bool declareToInterpreter(std::string const &code);
 
+   bool loadLibrary(std::string const &directory);
+   std::string librarySource() const;
+
    using Func = double (*)(double *, double const *, double const *);
    using Grad = void (*)(double *, double const *, double const *, double *);
 
@@ -89,10 +98,13 @@ private:
    std::unique_ptr<RooAbsReal> _absReal;
    RooListProxy _params;
    std::string _funcName;
-   Func _func;
-   Grad _grad;
+   std::string _funcBody;
+   std::string _codeHash;
+   Func _func = nullptr;
+   Grad _grad = nullptr;
    bool _hasGradient = false;
    bool _useEvaluator = false;
+   bool _exportable = false;
    mutable std::vector<double> _gradientVarBuffer;
    std::vector<double> _observables;
    std::map<RooFit::Detail::DataKey, ObsInfo> _obsInfos;
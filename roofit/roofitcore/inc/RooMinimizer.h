@@ -52,7 +52,10 @@ public:
 
       Config() {}
 
-      bool useGradient = true; // Use the gradient provided by the RooAbsReal, if there is one.
+      // Use the gradient provided by the RooAbsReal, if there is one. Minuit2 then also computes the Hessian from the
+      // gradient. Only likelihoods created with EvalBackend::Codegen() provide one, generated by Clad. There are no
+      // hand-written analytical gradients of individual pdfs, so the other backends use numerical gradients.
+      bool useGradient = true;
 
       double recoverFromNaN = 10.; // RooAbsMinimizerFcn config
       int printEvalErrors = 10;    // RooAbsMinimizerFcn config
@@ -73,6 +76,16 @@ public:
       // argument is ignored when parallelize is 0
       bool enableParallelDescent = false;
 
+      // Experimental: RooAbsMinimizerFcn config that can only be set in constructor
+      // argument is ignored when parallelize is 0. Evaluate the components of a RooSumL
+      // likelihood (e.g. the channels of a simultaneous fit) on threads of this process
+      // instead of on RooFit::MultiProcess workers. Only the components are parallel:
+      // the events of one component are evaluated on one thread, and the partial
+      // derivatives of the gradient are computed one after the other. The number of
+      // threads is parallelize, or the size of the ROOT thread pool for -1. The two
+      // options above are then ignored.
+      bool parallelizeComponentsWithThreads = false;
+
       bool verbose = false;        // local config
       bool profile = false;        // local config
       bool timingAnalysis = false; // local config
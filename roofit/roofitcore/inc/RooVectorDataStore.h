@@ -89,15 +89,14 @@ public:
   /// @{
   ArraysStruct getArrays() const;
   void recomputeSumWeight();
+  // reserve storage for nEvt entries
+  void reserve(Int_t nEvt);
   /// @}
 
 private:
   RooArgSet varsNoWeight(const RooArgSet& allVars, const char* wgtName);
   RooRealVar* weightVar(const RooArgSet& allVars, const char* wgtName);
 
-  // reserve storage for nEvt entries
-  void reserve(Int_t nEvt);
-
 public:
   // Write current row
   Int_t fill() override;
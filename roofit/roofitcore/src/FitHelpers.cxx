@@ -39,6 +39,8 @@
 
 #include <Math/CholeskyDecomp.h>
 
+#include <TEnv.h>
+
 #include "ConstraintHelpers.h"
 #include "RooEvaluatorWrapper.h"
 #include "RooFitImplHelpers.h"
@@ -774,14 +776,20 @@ std::unique_ptr<RooAbsReal> createNLL(RooAbsPdf &pdf, RooAbsData &data, const Ro
           evalBackend == RooFit::EvalBackend::Value::CodegenNoGrad) {
          bool createGradient = evalBackend == RooFit::EvalBackend::Value::Codegen;
          auto simPdf = dynamic_cast<RooSimultaneous const *>(pdfClone.get());
-         nllWrapper = std::make_unique<RooFit::Experimental::RooFuncWrapper>("nll_func_wrapper", "nll_func_wrapper",
-                                                                             *nll, &data, simPdf, createGradient);
+         // Compiled functions exported with RooFuncWrapper::exportLibrary() are looked up in this directory
+         const std::string libraryDirectory = gEnv->GetValue("RooFit.Codegen.LibraryDir", "");
+         nllWrapper = std::make_unique<RooFit::Experimental::RooFuncWrapper>(
+            "nll_func_wrapper", "nll_func_wrapper", *nll, &data, simPdf, createGradient, libraryDirectory);
          if (createGradient)
             static_cast<Experimental::RooFuncWrapper &>(*nllWrapper).createGradient();
       } else {
          nllWrapper = std::make_unique<RooEvaluatorWrapper>(
             *nll, &data, evalBackend == RooFit::EvalBackend::Value::Cuda, rangeName ? rangeName : "", pdfClone.get(),
             takeGlobalObservablesFromData);
+         // The parallelization strategy of NumCPU() only applies to the legacy backend. Here, the events are
+         // always split in chunks that are evaluated by threads.
+         if (pc.getInt("numcpu") > 1)
+            static_cast<RooEvaluatorWrapper &>(*nllWrapper).setNThreads(pc.getInt("numcpu"));
       }
 
       nllWrapper->addOwnedComponents(std::move(nll));
@@ -31,6 +31,7 @@ prototype data etc..
 #include "RooRandom.h"
 #include "RooAbsPdf.h"
 #include "RooDataSet.h"
+#include "RooVectorDataStore.h"
 #include "RooMsgService.h"
 #include "RooGlobalFunc.h"
 
@@ -192,6 +193,11 @@ RooDataSet *RooAbsGenContext::generate(double nEvents, bool skipInit, bool exten
   // WVE need specialization here for simultaneous pdfs
   _genData = createDataSet(name.Data(), title.Data(), _theEvent);
 
+  // Allocate the columns of the output only once, which matters for large samples
+  if (auto vstore = dynamic_cast<RooVectorDataStore *>(_genData->store())) {
+    vstore->reserve(static_cast<Int_t>(nEvents));
+  }
+
   // Perform any subclass implementation-specific initialization
   // Can be skipped if this is a rerun with an identical configuration
   if (!skipInit) {
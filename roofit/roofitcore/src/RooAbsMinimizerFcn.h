@@ -91,6 +91,9 @@ public:
    /// Enable or disable offsetting on the function to be minimized, which enhances numerical precision.
    virtual void setOffsetting(bool flag) = 0;
    virtual ROOT::Math::IMultiGenFunction *getMultiGenFcn() = 0;
+   /// Whether the gradient passed to the minimizer is exact, e.g. generated by automatic differentiation, and not
+   /// itself computed with finite differences.
+   virtual bool hasExactGradient() const { return false; }
 
    RooMinimizer::Config const &cfg() const { return _context->_cfg; }
 
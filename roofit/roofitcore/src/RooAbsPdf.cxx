@@ -167,12 +167,19 @@ called for each data event.
 #include "RooHelpers.h"
 #include "RooFormulaVar.h"
 #include "RooDerivative.h"
+#include "RooVectorDataStore.h"
 
 #include "ROOT/StringUtils.hxx"
 #include "TMath.h"
 #include "TPaveText.h"
 #include "TMatrixD.h"
 #include "TMatrixDSym.h"
+#include "TRandom3.h"
+
+#ifndef _WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
 
 #include <algorithm>
 #include <iostream>
@@ -834,7 +841,10 @@ double RooAbsPdf::extendedTerm(RooAbsData const& data, bool weightSquared, bool
  *                                                  \f]
  * <tr><td> `Range(double lo, double hi)` <td>  Fit only data inside given range. A range named "fit" is created on the fly on all observables.
  * <tr><td> `SumCoefRange(const char* name)`  <td> Set the range in which to interpret the coefficients of RooAddPdf components
- * <tr><td> `NumCPU(int num, int istrat)`      <td> Parallelize NLL calculation on num CPUs
+ * <tr><td> `NumCPU(int num, int istrat)`      <td> Parallelize NLL calculation on num CPUs.
+ *                                               With the **cpu** and **cuda** backends, the CPU computations on the events are split
+ *                                               in chunks that are evaluated by num threads, and the strategy is ignored.
+ *                                               With the **legacy** backend, the events are distributed over num processes according to the strategy:
  *   <table>
  *   <tr><th> Strategy   <th> Effect
  *   <tr><td> 0 = RooFit::BulkPartition - *default* <td> Divide events in N equal chunks
@@ -1151,6 +1161,102 @@ RooAbsGenContext* RooAbsPdf::autoGenContext(const RooArgSet &vars, const RooData
 
 
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the events in `nWorkers` processes forked from the current one.
+/// The events are split in one chunk per process. Each chunk is generated
+/// from its own clone of the model, with a TRandom3 that is seeded from the
+/// state of RooRandom::randomGenerator() and the index of the chunk. The
+/// chunks are merged in order, so the result only depends on this seed and
+/// the number of processes.
+
+std::unique_ptr<RooDataSet> generateMultiProcess(RooAbsPdf const &pdf, const RooArgSet &whatVars, double nEvents,
+                                                 bool verbose, bool extended, int nWorkers)
+{
+#ifdef _WIN32
+   oocoutW(&pdf, Generation) << "RooAbsPdf::generate(" << pdf.GetName()
+                             << ") multi-process generation is not supported on Windows, generating the events serially."
+                             << std::endl;
+   return std::unique_ptr<RooDataSet>{pdf.generate(whatVars, nEvents, verbose, false, "", false, extended)};
+#else
+   // Fix the number of events here, such that it is not fluctuated in each chunk
+   if (nEvents <= 0) {
+      if (pdf.extendMode() == RooAbsPdf::CanNotBeExtended) {
+         // let the serial generation report the error
+         return std::unique_ptr<RooDataSet>{pdf.generate(whatVars, nEvents, verbose, false, "", false, extended)};
+      }
+      nEvents = pdf.expectedEvents(&whatVars);
+   }
+   if (extended) {
+      nEvents = RooRandom::randomGenerator()->Poisson(nEvents);
+   }
+   const Int_t nTotal = static_cast<Int_t>(std::ceil(nEvents));
+   if (nTotal == 0) {
+      return std::make_unique<RooDataSet>("emptyData", "emptyData", whatVars);
+   }
+
+   const unsigned int nChunks = std::min<unsigned int>(nWorkers, nTotal);
+   // A seed of zero would make TRandom3 choose a random seed
+   const ULong_t seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   oocoutI(&pdf, Generation) << "RooAbsPdf::generate(" << pdf.GetName() << ") generating " << nTotal
+                             << " events in " << nChunks << " processes" << std::endl;
+
+   // Runs in the forked processes, which have their own copy of the model
+   auto generateChunk = [&](unsigned int iChunk) -> RooDataSet * {
+      RooRandom::setRandomGenerator(new TRandom3(seed + iChunk + 1));
+
+      // generate with a clone, to not share any caches with the model of the parent process
+      std::unique_ptr<RooAbsPdf> clone{static_cast<RooAbsPdf *>(pdf.cloneTree())};
+      RooArgSet cloneNodes;
+      clone->treeNodeServerList(&cloneNodes);
+      RooArgSet cloneVars;
+      for (RooAbsArg *arg : whatVars) {
+         // variables the model doesn't depend on are generated uniformly
+         RooAbsArg *cloneArg = cloneNodes.find(*arg);
+         cloneVars.add(cloneArg ? *cloneArg : *arg);
+      }
+
+      const Int_t nChunkEvents = nTotal / nChunks + (Int_t(iChunk) < nTotal % Int_t(nChunks) ? 1 : 0);
+      std::unique_ptr<RooDataSet> chunk{clone->generate(cloneVars, nChunkEvents, verbose, false, "", false, false)};
+      // the results are not received in order, so we pass the chunk index in the name
+      if (chunk) chunk->SetName(std::to_string(iChunk).c_str());
+      return chunk.release();
+   };
+
+   ROOT::TProcessExecutor executor(nChunks);
+   std::vector<RooDataSet *> chunks = executor.Map(generateChunk, ROOT::TSeq<unsigned int>(nChunks));
+
+   std::vector<std::unique_ptr<RooDataSet>> ordered(nChunks);
+   for (RooDataSet *chunk : chunks) {
+      if (chunk) ordered[std::stoul(chunk->GetName())].reset(chunk);
+   }
+   for (auto const &chunk : ordered) {
+      if (!chunk) {
+         oocoutE(&pdf, Generation) << "RooAbsPdf::generate(" << pdf.GetName()
+                                   << ") the generation failed in at least one process" << std::endl;
+         return nullptr;
+      }
+   }
+
+   // Merge the columns of the chunks in order into the first one
+   std::unique_ptr<RooDataSet> output = std::move(ordered[0]);
+   output->SetNameTitle((std::string(pdf.GetName()) + "Data").c_str(),
+                        (std::string("Generated From ") + pdf.GetTitle()).c_str());
+   if (auto vstore = dynamic_cast<RooVectorDataStore *>(output->store())) {
+      vstore->reserve(nTotal);
+   }
+   for (std::size_t i = 1; i < ordered.size(); ++i) {
+      output->append(*ordered[i]);
+   }
+
+   return output;
+#endif
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Generate a new dataset containing the specified variables with events sampled from our distribution.
 /// Generate the specified number of events or expectedEvents() if not specified.
@@ -1183,6 +1289,12 @@ RooAbsGenContext* RooAbsPdf::autoGenContext(const RooArgSet &vars, const RooData
 ///       as binned generation is always executed at the top-level node for a regular
 ///       PDF, so for those it only mattes that the top-level node is tagged.
 ///
+/// <tr><td> `NumCPU(int nCPU)`                  <td> Generate the events in nCPU processes forked from the current one (not on Windows).
+///                                                 Each process generates an equal share of the events with its own clone of the model
+///                                                 and its own random generator, which is seeded from RooRandom::randomGenerator().
+///                                                 The result is reproducible for the same seed and number of processes. This
+///                                                 is ignored for binned generation, for expected data and with ProtoData().
+///
 /// <tr><td> ProtoData(const RooDataSet& data, bool randOrder)
 ///          <td> Use specified dataset as prototype dataset. If randOrder in ProtoData() is set to true,
 ///               the order of the events in the dataset will be read in a random order if the requested
@@ -1223,6 +1335,7 @@ RooFit::OwningPtr<RooDataSet> RooAbsPdf::generate(const RooArgSet& whatVars, con
   pc.defineInt("expectedData","ExpectedData",0,0) ;
   pc.defineDouble("nEventsD","NumEventsD",0,-1.) ;
   pc.defineString("binnedTag","GenBinned",0,"") ;
+  pc.defineInt("nWorkers","NumCPU",0,1) ;
   pc.defineMutex("GenBinned","ProtoData") ;
   pc.defineMutex("Extended", "NumEvents");
 
@@ -1245,6 +1358,7 @@ RooFit::OwningPtr<RooDataSet> RooAbsPdf::generate(const RooArgSet& whatVars, con
   double nEventsD = pc.getInt("nEventsD") ;
   //bool verbose = pc.getInt("verbose") ;
   bool expectedData = pc.getInt("expectedData") ;
+  int nWorkers = pc.getInt("nWorkers") ;
 
   double nEvents = (nEventsD>0) ? nEventsD : double(nEventsI);
 
@@ -1272,6 +1386,8 @@ RooFit::OwningPtr<RooDataSet> RooAbsPdf::generate(const RooArgSet& whatVars, con
   std::unique_ptr<RooDataSet> data;
   if (protoData) {
     data = std::unique_ptr<RooDataSet>{generate(whatVars,*protoData,Int_t(nEvents),verbose,randProto,resampleProto)};
+  } else if (nWorkers > 1 && !expectedData && !(autoBinned && isBinnedDistribution(whatVars)) && strlen(binnedTag) == 0) {
+     data = generateMultiProcess(*this, whatVars, nEvents, verbose, extended, nWorkers);
   } else {
      data = std::unique_ptr<RooDataSet>{generate(whatVars,nEvents,verbose,autoBinned,binnedTag,expectedData, extended)};
   }
@@ -100,6 +100,7 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <sys/types.h>
 
@@ -158,6 +159,14 @@ private:
    std::stack<std::vector<double>> _vectorBuffers;
 };
 
+// Protects the evaluation error log, which is filled from several threads when
+// likelihood components are evaluated concurrently.
+std::mutex &evalErrorMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
 } // namespace
 
 ClassImp(RooAbsReal)
@@ -3384,11 +3393,12 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
   }
 
   if (_evalErrorMode==CountErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex());
     _evalErrorCount++ ;
     return ;
   }
 
-  static bool inLogEvalError = false ;
+  thread_local bool inLogEvalError = false ;
 
   if (inLogEvalError) {
     return ;
@@ -3408,6 +3418,7 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
          << " message      : " << ee._msg << std::endl
          << " server values: " << ee._srvval << std::endl ;
   } else if (_evalErrorMode==CollectErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex());
     _evalErrorList[originator].first = origName ;
     _evalErrorList[originator].second.push_back(ee) ;
   }
@@ -3439,11 +3450,12 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
   }
 
   if (_evalErrorMode==CountErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex());
     _evalErrorCount++ ;
     return ;
   }
 
-  static bool inLogEvalError = false ;
+  thread_local bool inLogEvalError = false ;
 
   if (inLogEvalError) {
     return ;
@@ -3482,6 +3494,7 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
           << " message      : " << ee._msg << std::endl
           << " server values: " << ee._srvval << std::endl ;
   } else if (_evalErrorMode==CollectErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex());
     if (_evalErrorList[this].second.size() >= 2048) {
        // avoid overflowing the error list, so if there are very many, print
        // the oldest one first, and pop it off the list
@@ -3511,6 +3524,7 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
 
 void RooAbsReal::clearEvalErrorLog()
 {
+  std::lock_guard<std::mutex> lock(evalErrorMutex());
   if (_evalErrorMode==PrintErrors) {
     return ;
   } else if (_evalErrorMode==CollectErrors) {
@@ -3551,6 +3565,7 @@ std::list<double>* RooAbsReal::plotSamplingHint(RooAbsRealLValue& /*obs*/, doubl
 
 void RooAbsReal::printEvalErrors(std::ostream& os, Int_t maxPerNode)
 {
+  std::lock_guard<std::mutex> lock(evalErrorMutex());
   if (_evalErrorMode == CountErrors) {
     os << _evalErrorCount << " errors counted" << std::endl ;
   }
@@ -3590,6 +3605,7 @@ void RooAbsReal::printEvalErrors(std::ostream& os, Int_t maxPerNode)
 
 Int_t RooAbsReal::numEvalErrors()
 {
+  std::lock_guard<std::mutex> lock(evalErrorMutex());
   if (_evalErrorMode==CountErrors) {
     return _evalErrorCount ;
   }
@@ -3602,6 +3618,16 @@ Int_t RooAbsReal::numEvalErrors()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of objects with logged evaluation errors since the last clearing.
+
+Int_t RooAbsReal::numEvalErrorItems()
+{
+  std::lock_guard<std::mutex> lock(evalErrorMutex());
+  return _evalErrorList.size() ;
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fix the interpretation of the coefficient of any RooAddPdf component in
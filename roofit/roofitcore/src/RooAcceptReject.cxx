@@ -219,11 +219,13 @@ const RooArgSet *RooAcceptReject::generateEvent(UInt_t remaining, double& resamp
     // Generation with a priori maximum knowledge
     _maxFuncVal = _funcMaxVal->getVal() ;
 
-    // Generate enough trials to produce a single accepted event
-    event = nullptr ;
-    while(nullptr==event) {
-      addEventToCache() ;
-      event = nextAcceptedEvent() ;
+    // Generate enough trials to produce a single accepted event. The trials
+    // don't need to go through the cache, as each of them is accepted or
+    // rejected right away: the trial point is already in the cache variables.
+    // This uses the same random numbers as sampling from the cache.
+    while (true) {
+      const double val = generateTrial();
+      if (RooRandom::uniform() * _maxFuncVal <= val) break;
     }
 
   }
@@ -265,10 +267,11 @@ const RooArgSet *RooAcceptReject::nextAcceptedEvent()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Add a trial event to our cache and update our estimates
-/// of the function maximum value and integral.
+/// Set the generated variables to a random trial point, and update our
+/// estimates of the function maximum value and integral. Returns the function
+/// value at the trial point.
 
-void RooAcceptReject::addEventToCache()
+double RooAcceptReject::generateTrial()
 {
   // randomize each discrete argument
   for(auto * cat : static_range_cast<RooCategory*>(_catVars)) cat->randomize();
@@ -285,15 +288,25 @@ void RooAcceptReject::addEventToCache()
   // corresponding loss of efficiency.
   if(val > _maxFuncVal) _maxFuncVal= 1.05*val;
   _funcSum+= val;
-
-  // fill a new entry in our cache dataset for this point
-  _cache->fill();
   _totalEvents++;
 
   if (_verbose &&_totalEvents%10000==0) {
     cerr << "RooAcceptReject: generated " << _totalEvents << " events so far." << endl ;
   }
 
+  return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a trial event to our cache and update our estimates
+/// of the function maximum value and integral.
+
+void RooAcceptReject::addEventToCache()
+{
+  generateTrial();
+
+  // fill a new entry in our cache dataset for this point
+  _cache->fill();
 }
 
 double RooAcceptReject::getFuncMax()
@@ -52,6 +52,7 @@ protected:
   friend class RooNumGenFactory ;
   static void registerSampler(RooNumGenFactory& fact) ;
 
+  double generateTrial();
   void addEventToCache();
   const RooArgSet *nextAcceptedEvent();
 
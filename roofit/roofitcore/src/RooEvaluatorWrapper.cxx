@@ -66,6 +66,12 @@ RooEvaluatorWrapper::RooEvaluatorWrapper(const RooEvaluatorWrapper &other, const
    _paramSet.add(other._paramSet);
 }
 
+/// Sets the number of threads over which the evaluation of large arrays is split, see RooFit::Evaluator::setNThreads().
+void RooEvaluatorWrapper::setNThreads(std::size_t nThreads)
+{
+   _evaluator->setNThreads(nThreads);
+}
+
 double RooEvaluatorWrapper::evaluate() const
 {
    if (!_evaluator)
@@ -58,6 +58,8 @@ public:
       _evaluator->print(os);
    }
 
+   void setNThreads(std::size_t nThreads);
+
    /// The RooFit::Evaluator is dealing with constant terms itself.
    void constOptimizeTestStatistic(ConstOpCode /*opcode*/, bool /*doAlsoTrackingOpt*/) override {}
 
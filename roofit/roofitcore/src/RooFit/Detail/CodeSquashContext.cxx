@@ -22,9 +22,12 @@ namespace RooFit {
 
 namespace Detail {
 
+/// @param exportable Whether the code will be compiled into a library that is reused for other datasets, see
+/// buildDataIndex().
 CodeSquashContext::CodeSquashContext(std::map<RooFit::Detail::DataKey, std::size_t> const &outputSizes,
-                                     std::vector<double> &xlarr, Experimental::RooFuncWrapper &wrapper)
-   : _wrapper{&wrapper}, _nodeOutputSizes(outputSizes), _xlArr(xlarr)
+                                     std::vector<double> &xlarr, Experimental::RooFuncWrapper &wrapper,
+                                     bool exportable)
+   : _wrapper{&wrapper}, _nodeOutputSizes(outputSizes), _xlArr(xlarr), _exportable{exportable}
 {
 }
 
@@ -92,13 +95,16 @@ std::string CodeSquashContext::assembleCode(std::string const &returnExpr)
 /// @brief Since the squashed code represents all observables as a single flattened array, it is important
 /// to keep track of the start index for a vector valued observable which can later be expanded to access the correct
 /// element. For example, a vector valued variable x with 10 entries will be squashed to obs[start_idx + i].
+/// The start index and the number of entries are read from the auxiliary array, see buildDataIndex().
 /// @param key The name of the node representing the vector valued observable.
 /// @param idx The start index (or relative position of the observable in the set of all observables).
 void CodeSquashContext::addVecObs(const char *key, int idx)
 {
    const TNamed *namePtr = RooNameReg::known(key);
-   if (namePtr)
-      _vecObsIndices[namePtr] = idx;
+   if (!namePtr)
+      return;
+   std::string idxExpr = buildDataIndex(idx);
+   _vecObsIndices[namePtr] = {idxExpr, buildDataIndex(outputSize(namePtr))};
 }
 
 /// @brief Adds the input string to the squashed code body. If a class implements a translate function that wants to
@@ -143,26 +149,30 @@ std::unique_ptr<CodeSquashContext::LoopScope> CodeSquashContext::beginLoop(RooAb
          continue;
 
       vars.push_back(it.first);
-      _nodeNames[it.first] = "obs[" + std::to_string(it.second) + " + " + idx + "]";
+      _nodeNames[it.first] = "obs[" + it.second.idx + " + " + idx + "]";
    }
 
-   // TODO: we are using the size of the first loop variable to the the number
-   // of iterations, but it should be made sure that all loop vars are either
-   // scalar or have the same size.
+   // The number of iterations is the size of the loop variables, which must
+   // all be either scalar or have the same size. It is read from the auxiliary
+   // array, so that the code doesn't depend on the number of entries.
    std::size_t numEntries = 1;
+   std::string numEntriesExpr = "1";
    for (auto &it : vars) {
       std::size_t n = outputSize(it);
       if (n > 1 && numEntries > 1 && n != numEntries) {
          throw std::runtime_error("Trying to loop over variables with different sizes!");
       }
-      numEntries = std::max(n, numEntries);
+      if (n > numEntries) {
+         numEntries = n;
+         numEntriesExpr = _vecObsIndices.at(it).size;
+      }
    }
 
    // Save the current size of the code array so that we can insert the code at the right position.
    _scopePtr = _code.size();
 
    // Make sure that the name of this variable doesn't clash with other stuff
-   addToCodeBody(in, "for(int " + idx + " = 0; " + idx + " < " + std::to_string(numEntries) + "; " + idx + "++) {\n");
+   addToCodeBody(in, "for(int " + idx + " = 0; " + idx + " < " + numEntriesExpr + "; " + idx + "++) {\n");
 
    ++_loopLevel;
    return std::make_unique<LoopScope>(*this, std::move(vars));
@@ -258,6 +268,21 @@ std::string CodeSquashContext::buildArg(std::span<const double> arr)
    return "xlArr + " + offset;
 }
 
+/// @brief Emit an integer that depends on the data, like a number of entries or the position of an observable in the
+/// array of observables. For exportable code it is stored in the auxiliary array instead of being written into the
+/// code, such that the squashed code only depends on the structure of the model and can be reused for other datasets,
+/// see RooFuncWrapper::codeHash(). Otherwise it is a literal, which the compiler can optimize for.
+/// @param value The integer.
+/// @return The expression of the integer in the squashed code.
+std::string CodeSquashContext::buildDataIndex(std::size_t value)
+{
+   if (!_exportable)
+      return std::to_string(value);
+   std::string offset = std::to_string(_xlArr.size());
+   _xlArr.push_back(value);
+   return "static_cast<int>(xlArr[" + offset + "])";
+}
+
 bool CodeSquashContext::isScopeIndependent(RooAbsArg const *in) const
 {
    return !in->isReducerNode() && outputSize(in->namePtr()) == 1;
@@ -42,6 +42,10 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include "RooFit/Detail/BatchModeDataHelpers.h"
 #include "RooFitImplHelpers.h"
 
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
 #include <chrono>
 #include <iomanip>
 #include <numeric>
@@ -673,4 +677,36 @@ void Evaluator::setOffsetMode(RooFit::EvalContext::OffsetMode mode)
    }
 }
 
+/// \brief Sets the number of threads for the evaluation on the CPU.
+///
+/// The computations of all nodes on large arrays of events are split in
+/// chunks that are evaluated in parallel by a ROOT::TThreadExecutor with the
+/// given number of threads. The executor is created here and lives as long as
+/// the Evaluator, so that an evaluation only costs the scheduling of the chunks.
+/// The negative log-likelihood is summed over chunks of fixed size that are
+/// added in a fixed order, so the result doesn't depend on the number of
+/// threads. The nodes themselves are still evaluated one after the other, in
+/// the order of the computation graph.
+///
+/// \param nThreads The number of threads. With 1, everything is evaluated in
+///                 the calling thread.
+void Evaluator::setNThreads(std::size_t nThreads)
+{
+#ifdef R__USE_IMT
+   _threadExecutor = nThreads > 1 ? std::make_shared<ROOT::TThreadExecutor>(nThreads) : nullptr;
+#else
+   if (nThreads > 1) {
+      oocoutW(&_topNode, Fitting) << "Evaluator::setNThreads(" << nThreads
+                                  << "): ROOT was built without implicit multi-threading, "
+                                     "evaluating on a single thread"
+                                  << std::endl;
+   }
+#endif
+   for (auto &nodeInfo : _nodes) {
+      RooBatchCompute::Config cfg = _evalContextCPU.config(nodeInfo.absArg);
+      cfg.setThreadExecutor(_threadExecutor);
+      _evalContextCPU.setConfig(nodeInfo.absArg, cfg);
+   }
+}
+
 } // namespace RooFit
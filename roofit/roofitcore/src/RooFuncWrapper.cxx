@@ -23,18 +23,57 @@
 #include <RooSimultaneous.h>
 #include "RooEvaluatorWrapper.h"
 
+#include <TMD5.h>
 #include <TROOT.h>
 #include <TSystem.h>
 
+#include <algorithm>
 #include <fstream>
+#include <string_view>
 
 namespace RooFit {
 
 namespace Experimental {
 
+namespace {
+
+// Name of the library that contains the compiled function with the given code hash, without extension.
+std::string libraryStem(std::string const &directory, std::string const &codeHash)
+{
+   return directory + "/RooFitCodegen_" + codeHash;
+}
+
+std::string librarySymbol(std::string const &codeHash)
+{
+   return "roofit_codegen_" + codeHash;
+}
+
+// Code that asks Clad to generate the gradient <funcName>_grad_0 of a declared function.
+std::string cladGradientRequest(std::string const &funcName)
+{
+   // disable clang-format for making the following code unreadable.
+   // clang-format off
+   std::stringstream requestFuncStrm;
+   requestFuncStrm << "#pragma clad ON\n"
+                      "void " << funcName << "_req() {\n"
+                      "  clad::gradient(" << funcName << ", \"params\");\n"
+                      "}\n"
+                      "#pragma clad OFF";
+   // clang-format on
+   return requestFuncStrm.str();
+}
+
+} // namespace
+
+/// @param libraryDirectory Directory in which to look for a library written by exportLibrary() with the code hash of
+/// this function, which is then used instead of the interpreter. If not empty, the code is generated such that it
+/// can be exported, else exportLibrary() refuses it.
 RooFuncWrapper::RooFuncWrapper(const char *name, const char *title, RooAbsReal &obj, const RooAbsData *data,
-                               RooSimultaneous const *simPdf, bool useEvaluator)
-   : RooAbsReal{name, title}, _params{"!params", "List of parameters", this}, _useEvaluator{useEvaluator}
+                               RooSimultaneous const *simPdf, bool useEvaluator, std::string const &libraryDirectory)
+   : RooAbsReal{name, title},
+     _params{"!params", "List of parameters", this},
+     _useEvaluator{useEvaluator},
+     _exportable{!libraryDirectory.empty()}
 {
    if (_useEvaluator) {
       _absReal = std::make_unique<RooEvaluatorWrapper>(obj, const_cast<RooAbsData *>(data), false, "", simPdf, false);
@@ -57,6 +96,19 @@ RooFuncWrapper::RooFuncWrapper(const char *name, const char *title, RooAbsReal &
 
    func = buildCode(obj);
 
+   // The key of the compiled library. The observables, parameters and auxiliary constants are passed as arrays, and
+   // for exportable code so are the numbers of entries and the positions of the observables in the data, so the code
+   // only depends on the structure of the model. This includes the names of some nodes, e.g. the likelihood.
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(func.data()), func.size());
+   md5.Final();
+   _codeHash = md5.AsString();
+   _funcBody = func;
+
+   if (_exportable && loadLibrary(libraryDirectory)) {
+      return;
+   }
+
    declareToInterpreter("#pragma cling optimize(2)");
 
    // Declare the function and create its derivative.
@@ -68,9 +120,12 @@ RooFuncWrapper::RooFuncWrapper(const RooFuncWrapper &other, const char *name)
    : RooAbsReal(other, name),
      _params("!params", this, other._params),
      _funcName(other._funcName),
+     _funcBody(other._funcBody),
+     _codeHash(other._codeHash),
      _func(other._func),
      _grad(other._grad),
      _hasGradient(other._hasGradient),
+     _exportable(other._exportable),
      _gradientVarBuffer(other._gradientVarBuffer),
      _observables(other._observables)
 {
@@ -142,21 +197,23 @@ std::string RooFuncWrapper::declareFunction(std::string const &funcBody)
 
 void RooFuncWrapper::createGradient()
 {
+   // The gradient was already taken from a compiled library.
+   if (_grad) {
+      _hasGradient = true;
+      return;
+   }
+
+   // The function was loaded from a library that has no gradient, so it has to be declared for Clad.
+   if (_funcName.empty()) {
+      declareToInterpreter("#pragma cling optimize(2)");
+      _funcName = declareFunction(_funcBody);
+   }
+
    std::string gradName = _funcName + "_grad_0";
-   std::string requestName = _funcName + "_req";
 
    // Calculate gradient
    declareToInterpreter("#include <Math/CladDerivator.h>\n");
-   // disable clang-format for making the following code unreadable.
-   // clang-format off
-   std::stringstream requestFuncStrm;
-   requestFuncStrm << "#pragma clad ON\n"
-                      "void " << requestName << "() {\n"
-                      "  clad::gradient(" << _funcName << ", \"params\");\n"
-                      "}\n"
-                      "#pragma clad OFF";
-   // clang-format on
-   if (!declareToInterpreter(requestFuncStrm.str())) {
+   if (!declareToInterpreter(cladGradientRequest(_funcName))) {
       std::stringstream errorMsg;
       errorMsg << "Function " << GetName() << " could not be differentiated. See above for details.";
       oocoutE(nullptr, InputArguments) << errorMsg.str() << std::endl;
@@ -199,7 +256,7 @@ void RooFuncWrapper::gradient(const double *x, double *g) const
 
 std::string RooFuncWrapper::buildCode(RooAbsReal const &head)
 {
-   RooFit::Detail::CodeSquashContext ctx(_nodeOutputSizes, _xlArr, *this);
+   RooFit::Detail::CodeSquashContext ctx(_nodeOutputSizes, _xlArr, *this, _exportable);
 
    // First update the result variable of params in the compute graph to in[<position>].
    int idx = 0;
@@ -208,13 +265,22 @@ std::string RooFuncWrapper::buildCode(RooAbsReal const &head)
       idx++;
    }
 
+   // The positions of the observables are stored in the auxiliary array in the order of their names, which doesn't
+   // depend on the memory layout like the order of the DataKeys.
+   std::vector<std::pair<const char *, ObsInfo>> obsInfos;
    for (auto const &item : _obsInfos) {
-      const char *name = item.first->GetName();
+      obsInfos.emplace_back(item.first->GetName(), item.second);
+   }
+   std::sort(obsInfos.begin(), obsInfos.end(),
+             [](auto const &a, auto const &b) { return std::string_view{a.first} < std::string_view{b.first}; });
+
+   for (auto const &item : obsInfos) {
+      const char *name = item.first;
       // If the observable is scalar, set name to the start idx. else, store
       // the start idx and later set the the name to obs[start_idx + curr_idx],
       // here curr_idx is defined by a loop producing parent node.
       if (item.second.size == 1) {
-         ctx.addResult(name, "obs[" + std::to_string(item.second.idx) + "]");
+         ctx.addResult(name, "obs[" + ctx.buildDataIndex(item.second.idx) + "]");
       } else {
          ctx.addResult(name, "obs");
          ctx.addVecObs(name, item.second.idx);
@@ -231,14 +297,113 @@ bool RooFuncWrapper::declareToInterpreter(std::string const &code)
    return gInterpreter->Declare(code.c_str());
 }
 
+/// @brief Load the function and, if available, its gradient from a library written by exportLibrary().
+/// @param directory The directory of the library.
+/// @return True if the function was loaded, false if there is no library for this code hash.
+bool RooFuncWrapper::loadLibrary(std::string const &directory)
+{
+   const std::string libName = libraryStem(directory, _codeHash) + "." + gSystem->GetSoExt();
+   // AccessPathName() returns false if the file exists
+   if (gSystem->AccessPathName(libName.c_str()) || gSystem->Load(libName.c_str()) < 0) {
+      return false;
+   }
+   const std::string symbol = librarySymbol(_codeHash);
+   _func = reinterpret_cast<Func>(gSystem->DynFindSymbol(libName.c_str(), symbol.c_str()));
+   if (!_func) {
+      return false;
+   }
+   _grad = reinterpret_cast<Grad>(gSystem->DynFindSymbol(libName.c_str(), (symbol + "_grad").c_str()));
+   oocoutI(nullptr, Fitting) << "RooFuncWrapper(" << GetName() << "): using the compiled function in " << libName
+                             << std::endl;
+   return true;
+}
+
+/// @brief The source code of the library written by exportLibrary().
+///
+/// The function is exported with C linkage. The gradient can only be generated by compiling the source with Clang and
+/// the Clad plugin, defining `ROOFIT_CODEGEN_CLAD`. Otherwise, createGradient() uses Clad in the interpreter.
+std::string RooFuncWrapper::librarySource() const
+{
+   const std::string symbol = librarySymbol(_codeHash);
+   std::stringstream code;
+   code << "// Generated by RooFit::Experimental::RooFuncWrapper::exportLibrary()\n"
+        << "#include <RooFit/Detail/MathFuncs.h>\n"
+        << "#include <TMath.h>\n\n"
+        << "#include <cmath>\n\n"
+        << "extern \"C\" double " << symbol << "(double* params, double const* obs, double const* xlArr) {\n"
+        << _funcBody << "\n}\n\n"
+        << "#ifdef ROOFIT_CODEGEN_CLAD\n"
+        << "#include <clad/Differentiator/Differentiator.h>\n\n"
+        << "extern \"C\" void " << symbol
+        << "_grad(double* params, double const* obs, double const* xlArr, double* out) {\n"
+        << "   static auto grad = clad::gradient(" << symbol << ", \"params\");\n"
+        << "   grad.execute(params, obs, xlArr, out);\n"
+        << "}\n"
+        << "#endif\n";
+   return code.str();
+}
+
+/// @brief Compile the generated function into a shared library with ACLiC, such that other processes can load it
+/// instead of generating and jitting the code again. The library is named after the code hash, so all RooFuncWrappers
+/// of the same model created with the same library directory find it. Only functions created with a library directory
+/// can be exported, the code of the others depends on the data.
+/// @param directory The directory of the library.
+/// @return True if the library was written.
+bool RooFuncWrapper::exportLibrary(std::string const &directory) const
+{
+   if (directory.empty()) {
+      coutE(InputArguments) << "RooFuncWrapper::exportLibrary(" << GetName() << "): no directory given" << std::endl;
+      return false;
+   }
+   if (!_exportable) {
+      coutE(InputArguments) << "RooFuncWrapper::exportLibrary(" << GetName()
+                            << "): the function was created without library directory, its code depends on the data"
+                            << std::endl;
+      return false;
+   }
+   // Functions declared by other RooFuncWrappers, e.g. for numeric integrals, are not part of the exported code.
+   if (_funcBody.find("roo_func_wrapper_") != std::string::npos) {
+      coutE(InputArguments) << "RooFuncWrapper::exportLibrary(" << GetName()
+                            << "): the code calls other generated functions and cannot be exported" << std::endl;
+      return false;
+   }
+
+   gSystem->mkdir(directory.c_str(), true);
+   const std::string stem = libraryStem(directory, _codeHash);
+   const std::string sourceName = stem + ".cxx";
+   {
+      std::ofstream outFile(sourceName);
+      outFile << librarySource();
+   }
+   if (!gSystem->CompileMacro(sourceName.c_str(), "kOcs", stem.c_str())) {
+      coutE(InputArguments) << "RooFuncWrapper::exportLibrary(" << GetName() << "): compilation of " << sourceName
+                            << " failed" << std::endl;
+      return false;
+   }
+   return true;
+}
+
 /// @brief Dumps a macro "filename.C" that can be used to test and debug the generated code and gradient.
+///
+/// If the function was loaded from a library and never declared to the interpreter, the macro declares it under the
+/// symbol name of the library, together with the request for its gradient.
 void RooFuncWrapper::writeDebugMacro(std::string const &filename) const
 {
+   std::string funcName = _funcName;
+
    std::ofstream outFile;
    outFile.open(filename + ".C");
    outFile << "#include <RooFit/Detail/MathFuncs.h>" << std::endl;
    outFile << std::endl;
-   outFile << _allCode.str();
+   if (funcName.empty()) {
+      funcName = librarySymbol(_codeHash);
+      outFile << "#include <Math/CladDerivator.h>\n\n"
+              << "double " << funcName << "(double* params, double const* obs, double const* xlArr) {\n"
+              << _funcBody << "\n}\n\n"
+              << cladGradientRequest(funcName) << std::endl;
+   } else {
+      outFile << _allCode.str();
+   }
    outFile << std::endl;
 
    updateGradientVarBuffer();
@@ -271,9 +436,9 @@ void )" << filename
 {
    std::vector<double> gradientVec(parametersVec.size());
 
-   )" << _funcName
+   )" << funcName
            << R"((parametersVec.data(), observablesVec.data(), auxConstantsVec.data());
-   )" << _funcName
+   )" << funcName
            << R"(_grad_0(parametersVec.data(), observablesVec.data(), auxConstantsVec.data(), gradientVec.data());
 }
 )";
@@ -62,6 +62,7 @@ automatic PDF optimization.
 #endif
 
 #include "TClass.h"
+#include "Math/GenAlgoOptions.h"
 #include "Math/Minimizer.h"
 #include "TMarker.h"
 #include "TGraph.h"
@@ -104,12 +105,18 @@ RooMinimizer::RooMinimizer(RooAbsReal &function, Config const &cfg) : _cfg(cfg)
    initMinimizerFirstPart();
    auto nll_real = dynamic_cast<RooFit::TestStatistics::RooRealL *>(&function);
    if (nll_real != nullptr) {
-      if (_cfg.parallelize != 0) { // new test statistic with multiprocessing library with
+      if (_cfg.parallelize != 0 && _cfg.parallelizeComponentsWithThreads) {
+         // new test statistic with the components of each evaluation on threads and a serial gradient
+         _fcn = std::make_unique<RooFit::TestStatistics::MinuitFcnGrad>(
+            nll_real->getRooAbsL(), this, _theFitter->Config().ParamsSettings(),
+            RooFit::TestStatistics::LikelihoodMode::multithreadComponents,
+            RooFit::TestStatistics::LikelihoodGradientMode::serial, _cfg.parallelize > 0 ? _cfg.parallelize : 0);
+      } else if (_cfg.parallelize != 0) { // new test statistic with multiprocessing library with
                                    // parallel likelihood or parallel gradient
 #ifdef ROOFIT_MULTIPROCESS
          if (!_cfg.enableParallelGradient) {
-            // Note that this is necessary because there is currently no serial-mode LikelihoodGradientWrapper.
-            // We intend to repurpose RooGradMinimizerFcn to build such a LikelihoodGradientSerial class.
+            // Note that this is necessary because the serial-mode LikelihoodGradientWrapper is only used together
+            // with the multi-threaded likelihood, see Config::parallelizeComponentsWithThreads.
             coutI(InputArguments) << "Modular likelihood detected and likelihood parallelization requested, "
                                   << "also setting parallel gradient calculation mode." << std::endl;
             _cfg.enableParallelGradient = true;
@@ -194,6 +201,25 @@ void RooMinimizer::initMinimizerFcnDependentPart(double defaultErrorLevel)
    if (_cfg.offsetting != -1) {
       setOffsetting(_cfg.offsetting);
    }
+
+   // With an exact gradient, Minuit2 computes the Hessian from differences of the gradient, which takes 2N gradient
+   // evaluations instead of O(N^2) function evaluations. It can be disabled with the Minuit2 option
+   // "HessianFromGradient" in the default extra options.
+   if (_fcn->hasExactGradient()) {
+      ROOT::Math::MinimizerOptions &options = _theFitter->Config().MinimizerOptions();
+      std::unique_ptr<ROOT::Math::IOptions> extraOptions;
+      if (options.ExtraOptions()) {
+         extraOptions.reset(options.ExtraOptions()->Clone());
+      } else if (ROOT::Math::IOptions *defaultOptions = ROOT::Math::MinimizerOptions::FindDefault("Minuit2")) {
+         extraOptions.reset(defaultOptions->Clone());
+      } else {
+         extraOptions = std::make_unique<ROOT::Math::GenAlgoOptions>();
+      }
+      int hessianFromGradient = 1;
+      extraOptions->GetValue("HessianFromGradient", hessianFromGradient);
+      extraOptions->SetValue("HessianFromGradient", hessianFromGradient);
+      options.SetExtraOptions(*extraOptions);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
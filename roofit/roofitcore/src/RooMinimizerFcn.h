@@ -46,6 +46,7 @@ public:
 
    void setOffsetting(bool flag) override;
    ROOT::Math::IMultiGenFunction *getMultiGenFcn() override { return _multiGenFcn.get(); }
+   bool hasExactGradient() const override { return cfg().useGradient && _funct->hasGradient(); }
 
    double operator()(const double *x) const;
    void evaluateGradient(const double *x, double *out) const;
@@ -224,7 +224,11 @@ void RooNLLVarNew::doEvalBinnedL(RooFit::EvalContext &ctx, std::span<const doubl
          mu *= _binw[i];
       }
 
-      if (mu <= 0 && N > 0) {
+      if (N == 0. && mu >= 0.) {
+         // Empty bins are frequent in large binned models. Their Poisson term
+         // is just mu, also with bin offsetting, so we don't need any logarithm.
+         result += mu;
+      } else if (mu <= 0 && N > 0) {
          // Catch error condition: data present where zero events are predicted
          logEvalError(Form("Observed %f events in bin %lu with zero event yield", N, (unsigned long)i));
       } else {
@@ -0,0 +1,135 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "LikelihoodGradientSerial.h"
+
+#include <RooFit/TestStatistics/RooAbsL.h>
+#include "RooMinimizer.h"
+
+#include "Minuit2/MnStrategy.h"
+
+namespace RooFit {
+namespace TestStatistics {
+
+/** \class LikelihoodGradientSerial
+ * \brief Gradient calculation strategy that computes the numerical derivatives in the calling process
+ *
+ * This computes the same numerical derivatives as LikelihoodGradientJob, with the ROOT::Minuit2::NumericalDerivator,
+ * but one partial derivative after the other in the process that runs the minimizer: the gradient itself is not
+ * parallelized. Only the likelihood evaluations it consists of can be, when the MinuitFcnGrad that owns this object
+ * uses a parallel LikelihoodWrapper like LikelihoodThreads. There is no communication with other processes.
+ *
+ * The derivatives move the RooFit parameters away from the point at which the gradient is requested. Their values are
+ * restored when the gradient is done.
+ *
+ * \note The class is not intended for use by end-users. We recommend to either use RooMinimizer with a RooAbsL derived
+ * likelihood object, or to use a higher level entry point like RooAbsPdf::fitTo() or RooAbsPdf::createNLL().
+ */
+
+LikelihoodGradientSerial::LikelihoodGradientSerial(std::shared_ptr<RooAbsL> likelihood,
+                                                   std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean,
+                                                   std::size_t N_dim, RooMinimizer *minimizer, SharedOffset offset)
+   : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer,
+                               std::move(offset)),
+     grad_(N_dim),
+     minuit_internal_x_(N_dim, 0.),
+     parameters_{likelihood_->getParameters()}
+{
+}
+
+void LikelihoodGradientSerial::synchronizeParameterSettings(
+   const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings)
+{
+   LikelihoodGradientWrapper::synchronizeParameterSettings(parameter_settings);
+}
+
+void LikelihoodGradientSerial::synchronizeParameterSettings(
+   ROOT::Math::IMultiGenFunction *function, const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings)
+{
+   gradf_.SetInitialGradient(function, parameter_settings, grad_);
+}
+
+void LikelihoodGradientSerial::synchronizeWithMinimizer(const ROOT::Math::MinimizerOptions &options)
+{
+   setStrategy(options.Strategy());
+   gradf_.SetErrorLevel(options.ErrorDef());
+}
+
+void LikelihoodGradientSerial::setStrategy(int istrat)
+{
+   assert(istrat >= 0);
+   ROOT::Minuit2::MnStrategy strategy(static_cast<unsigned int>(istrat));
+
+   gradf_.SetStepTolerance(strategy.GradientStepTolerance());
+   gradf_.SetGradTolerance(strategy.GradientTolerance());
+   gradf_.SetNCycles(strategy.GradientNCycles());
+}
+
+void LikelihoodGradientSerial::calculate_all()
+{
+   isCalculating_ = true;
+
+   RooArgSet savedValues;
+   parameters_->snapshot(savedValues);
+
+   auto *function = minimizer_->getMultiGenFcn();
+   auto const &parameterSettings = minimizer_->fitter()->Config().ParamsSettings();
+   gradf_.SetupDifferentiate(function, minuit_internal_x_.data(), parameterSettings);
+   for (std::size_t ix = 0; ix < grad_.size(); ++ix) {
+      grad_[ix] = gradf_.FastPartialDerivative(function, parameterSettings, ix, grad_[ix]);
+   }
+
+   parameters_->assign(savedValues);
+
+   calculation_is_clean_->gradient = true;
+   isCalculating_ = false;
+}
+
+void LikelihoodGradientSerial::fillGradient(double *grad)
+{
+   if (!calculation_is_clean_->gradient) {
+      calculate_all();
+   }
+
+   for (Int_t ix = 0; ix < minimizer_->getNPar(); ++ix) {
+      grad[ix] = grad_[ix].derivative;
+   }
+}
+
+void LikelihoodGradientSerial::fillGradientWithPrevResult(double *grad, double *previous_grad, double *previous_g2,
+                                                          double *previous_gstep)
+{
+   for (std::size_t ix = 0; ix < grad_.size(); ++ix) {
+      grad_[ix] = {previous_grad[ix], previous_g2[ix], previous_gstep[ix]};
+   }
+
+   if (!calculation_is_clean_->gradient) {
+      calculate_all();
+   }
+
+   for (Int_t ix = 0; ix < minimizer_->getNPar(); ++ix) {
+      grad[ix] = grad_[ix].derivative;
+      previous_g2[ix] = grad_[ix].second_derivative;
+      previous_gstep[ix] = grad_[ix].step_size;
+   }
+}
+
+void LikelihoodGradientSerial::updateMinuitInternalParameterValues(const std::vector<double> &minuit_internal_x)
+{
+   minuit_internal_x_ = minuit_internal_x;
+}
+
+bool LikelihoodGradientSerial::usesMinuitInternalValues()
+{
+   return true;
+}
+
+} // namespace TestStatistics
+} // namespace RooFit
@@ -0,0 +1,66 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientSerial
+#define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientSerial
+
+#include "RooFit/TestStatistics/LikelihoodGradientWrapper.h"
+#include "RooArgSet.h"
+
+#include "Math/MinimizerOptions.h"
+#include "Minuit2/NumericalDerivator.h"
+#include "Minuit2/MnMatrix.h"
+
+#include <vector>
+
+namespace RooFit {
+namespace TestStatistics {
+
+class LikelihoodGradientSerial : public LikelihoodGradientWrapper {
+public:
+   LikelihoodGradientSerial(std::shared_ptr<RooAbsL> likelihood,
+                            std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean, std::size_t N_dim,
+                            RooMinimizer *minimizer, SharedOffset offset);
+
+   void fillGradient(double *grad) override;
+   void fillGradientWithPrevResult(double *grad, double *previous_grad, double *previous_g2,
+                                   double *previous_gstep) override;
+
+   bool isCalculating() override { return isCalculating_; };
+
+private:
+   void synchronizeParameterSettings(ROOT::Math::IMultiGenFunction *function,
+                                     const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings) override;
+   // this overload must also be overridden here so that the one above doesn't trigger a overloaded-virtual warning:
+   void synchronizeParameterSettings(const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings) override;
+
+   void synchronizeWithMinimizer(const ROOT::Math::MinimizerOptions &options) override;
+   void setStrategy(int istrat);
+
+   void updateMinuitInternalParameterValues(const std::vector<double> &minuit_internal_x) override;
+
+   bool usesMinuitInternalValues() override;
+
+   void calculate_all();
+
+   // members
+
+   std::vector<ROOT::Minuit2::DerivatorElement> grad_;
+   ROOT::Minuit2::NumericalDerivator gradf_;
+   std::vector<double> minuit_internal_x_;
+   std::unique_ptr<RooArgSet> parameters_;
+
+   bool isCalculating_ = false;
+};
+
+} // namespace TestStatistics
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientSerial
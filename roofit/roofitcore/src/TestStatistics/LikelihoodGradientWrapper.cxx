@@ -14,6 +14,7 @@
 #include "RooMinimizer.h"
 
 // including derived classes for factory method
+#include "LikelihoodGradientSerial.h"
 #ifdef ROOFIT_MULTIPROCESS
 #include "LikelihoodGradientJob.h"
 #endif // ROOFIT_MULTIPROCESS
@@ -87,6 +88,10 @@ LikelihoodGradientWrapper::create(LikelihoodGradientMode likelihoodGradientMode,
 #endif
       break;
    }
+   case LikelihoodGradientMode::serial: {
+      return std::make_unique<LikelihoodGradientSerial>(std::move(likelihood), std::move(calculationIsClean), nDim,
+                                                        minimizer, std::move(offset));
+   }
    default: {
       throw std::logic_error("In MinuitFcnGrad constructor: likelihoodGradientMode has an unsupported value!");
    }
@@ -0,0 +1,151 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "LikelihoodThreads.h"
+
+#include <RooFit/TestStatistics/RooAbsL.h>
+#include "RooMsgService.h"
+#include "RooNaNPacker.h"
+
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include "TMath.h" // IsNaN
+
+namespace RooFit {
+namespace TestStatistics {
+
+/** \class LikelihoodThreads
+ * \brief Likelihood calculation strategy that evaluates the components of a RooSumL likelihood on threads
+ *
+ * This is the in-process counterpart of LikelihoodJob. Instead of sending the parameters to forked RooFit::MultiProcess
+ * workers, the components of a RooSumL are evaluated concurrently by a ROOT::TThreadExecutor that lives as long as this
+ * object, so that an evaluation only costs the scheduling of the component tasks.
+ *
+ * Every RooUnbinnedL and RooBinnedL component owns its pdf and dataset clones, and all components only read the shared
+ * parameters during an evaluation, so the components can be evaluated in parallel. Events of a single component are
+ * not split over threads here, because they share one pdf clone; with the cpu evaluation backend, use
+ * RooFit::Evaluator::setNThreads (NumCPU() in createNLL()) to parallelize over events instead.
+ *
+ * The component results are added in the same order as in LikelihoodSerial, so the result does not depend on the
+ * number of threads.
+ *
+ * \note The class is not intended for use by end-users. We recommend to either use RooMinimizer with a RooAbsL derived
+ * likelihood object, or to use a higher level entry point like RooAbsPdf::fitTo() or RooAbsPdf::createNLL().
+ */
+
+/// \param[in] nThreads Number of threads of the executor; zero uses the size of the ROOT thread pool.
+LikelihoodThreads::LikelihoodThreads(std::shared_ptr<RooAbsL> likelihood,
+                                     std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean,
+                                     SharedOffset offset, std::size_t nThreads)
+   : LikelihoodWrapper(std::move(likelihood), std::move(calculation_is_clean), std::move(offset))
+{
+#ifdef R__USE_IMT
+   if (likelihood_type_ == LikelihoodType::sum && likelihood_->getNComponents() > 1 && nThreads != 1) {
+      executor_ = std::make_unique<ROOT::TThreadExecutor>(nThreads);
+   }
+#else
+   if (nThreads != 1) {
+      oocoutW(nullptr, Minimization) << "LikelihoodThreads(" << GetName()
+                                     << "): ROOT was built without implicit multi-threading, "
+                                        "evaluating the likelihood on a single thread"
+                                     << std::endl;
+   }
+#endif
+}
+
+LikelihoodThreads::~LikelihoodThreads() = default;
+
+/// The components create their caches, like normalization integrals, when they are first evaluated. This connects
+/// new objects to the shared parameters, so it must not happen concurrently. The next evaluation after the parameter
+/// settings changed is therefore done in the calling thread.
+void LikelihoodThreads::synchronizeParameterSettings(
+   const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings)
+{
+   LikelihoodWrapper::synchronizeParameterSettings(parameter_settings);
+   warmed_up_ = false;
+}
+
+/// Evaluate the components concurrently. The evaluation error log is shared by all threads: each component compares
+/// RooAbsReal::numEvalErrors() before and after its evaluation to decide whether to cache its result, so an error of
+/// another component at the same time only prevents caching, it never lets an erroneous result be cached.
+void LikelihoodThreads::evaluateComponents()
+{
+   const std::size_t nComponents = likelihood_->getNComponents();
+   component_results_.resize(nComponents);
+   auto evaluateComponent = [&](std::size_t comp_ix) {
+      component_results_[comp_ix] = likelihood_->evaluatePartition({0, 1}, comp_ix, comp_ix + 1);
+   };
+
+#ifdef R__USE_IMT
+   if (executor_ && warmed_up_) {
+      executor_->Foreach(evaluateComponent, ROOT::TSeq<std::size_t>(nComponents));
+      return;
+   }
+#endif
+   for (std::size_t comp_ix = 0; comp_ix < nComponents; ++comp_ix) {
+      evaluateComponent(comp_ix);
+   }
+   warmed_up_ = true;
+}
+
+void LikelihoodThreads::evaluate()
+{
+   if (do_offset_ && shared_offset_.offsets().empty()) {
+      calculate_offsets();
+   }
+
+   switch (likelihood_type_) {
+   case LikelihoodType::unbinned:
+   case LikelihoodType::binned: {
+      result_ = likelihood_->evaluatePartition({0, 1}, 0, 0);
+      if (do_offset_) {
+         result_ -= shared_offset_.offsets()[0];
+      }
+      break;
+   }
+   case LikelihoodType::subsidiary: {
+      result_ = likelihood_->evaluatePartition({0, 1}, 0, 0);
+      if (do_offset_ && offsetting_mode_ == OffsettingMode::full) {
+         result_ -= shared_offset_.offsets()[0];
+      }
+      break;
+   }
+   case LikelihoodType::sum: {
+      evaluateComponents();
+
+      result_ = ROOT::Math::KahanSum<double>();
+      RooNaNPacker packedNaN;
+      for (std::size_t comp_ix = 0; comp_ix < component_results_.size(); ++comp_ix) {
+         auto const &component_result = component_results_[comp_ix];
+         packedNaN.accumulate(component_result.Sum());
+
+         if (do_offset_ && shared_offset_.offsets()[comp_ix] != ROOT::Math::KahanSum<double>(0, 0)) {
+            result_ += (component_result - shared_offset_.offsets()[comp_ix]);
+         } else {
+            result_ += component_result;
+         }
+      }
+      if (packedNaN.getPayload() != 0) {
+         result_ = ROOT::Math::KahanSum<double>(packedNaN.getNaNWithPayload());
+      }
+      break;
+   }
+   }
+
+   if (TMath::IsNaN(result_.Sum())) {
+      RooAbsReal::logEvalError(nullptr, GetName().c_str(), "function value is NAN");
+   }
+}
+
+} // namespace TestStatistics
+} // namespace RooFit
@@ -0,0 +1,57 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef ROOT_ROOFIT_TESTSTATISTICS_LikelihoodThreads
+#define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodThreads
+
+#include <RooFit/TestStatistics/LikelihoodWrapper.h>
+
+#include <RConfigure.h> // R__USE_IMT
+
+#include <memory>
+#include <vector>
+
+#ifdef R__USE_IMT
+namespace ROOT {
+class TThreadExecutor;
+}
+#endif
+
+namespace RooFit {
+namespace TestStatistics {
+
+class LikelihoodThreads : public LikelihoodWrapper {
+public:
+   LikelihoodThreads(std::shared_ptr<RooAbsL> likelihood,
+                     std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean, SharedOffset offset,
+                     std::size_t nThreads);
+   ~LikelihoodThreads() override;
+
+   void evaluate() override;
+   inline ROOT::Math::KahanSum<double> getResult() const override { return result_; }
+
+   void synchronizeParameterSettings(const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings) override;
+
+private:
+   void evaluateComponents();
+
+   ROOT::Math::KahanSum<double> result_;
+   std::vector<ROOT::Math::KahanSum<double>> component_results_;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> executor_;
+#endif
+   /// The first evaluation after (re)configuration runs in the calling thread, see synchronizeParameterSettings().
+   bool warmed_up_ = false;
+};
+
+} // namespace TestStatistics
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_TESTSTATISTICS_LikelihoodThreads
@@ -24,6 +24,7 @@
 
 // including derived classes for factory method
 #include "LikelihoodSerial.h"
+#include "LikelihoodThreads.h"
 #ifdef ROOFIT_MULTIPROCESS
 #include "LikelihoodJob.h"
 #endif // ROOFIT_MULTIPROCESS
@@ -208,9 +209,12 @@ void LikelihoodWrapper::updateMinuitInternalParameterValues(const std::vector<do
 void LikelihoodWrapper::updateMinuitExternalParameterValues(const std::vector<double> & /*minuit_external_x*/) {}
 
 /// Factory method.
+/// \param[in] nThreads Number of threads for LikelihoodMode::multithreadComponents; zero uses the size of the ROOT
+///            thread pool.
 std::unique_ptr<LikelihoodWrapper>
 LikelihoodWrapper::create(LikelihoodMode likelihoodMode, std::shared_ptr<RooAbsL> likelihood,
-                          std::shared_ptr<WrapperCalculationCleanFlags> calculationIsClean, SharedOffset offset)
+                          std::shared_ptr<WrapperCalculationCleanFlags> calculationIsClean, SharedOffset offset,
+                          std::size_t nThreads)
 {
    switch (likelihoodMode) {
    case LikelihoodMode::serial: {
@@ -225,6 +229,10 @@ LikelihoodWrapper::create(LikelihoodMode likelihoodMode, std::shared_ptr<RooAbsL
                                "without RooFit::Multiprocess!");
 #endif
    }
+   case LikelihoodMode::multithreadComponents: {
+      return std::make_unique<LikelihoodThreads>(std::move(likelihood), std::move(calculationIsClean),
+                                                 std::move(offset), nThreads);
+   }
    default: {
       throw std::logic_error("In MinuitFcnGrad constructor: likelihoodMode has an unsupported value!");
    }
@@ -77,12 +77,14 @@ private:
 /// \param[in] parameters The vector of ParameterSettings objects that describe the parameters used in the Minuit
 /// \param[in] likelihoodMode Lmode
 /// \param[in] likelihoodGradientMode Lgrad
+/// \param[in] nThreads Number of threads for LikelihoodMode::multithreadComponents; zero uses the size of the ROOT
+///            thread pool.
 /// \param[in] verbose true for verbose output
 /// Fitter. Note that these must match the set used in the Fitter used by \p context! It can be passed in from
 /// RooMinimizer with fitter()->Config().ParamsSettings().
 MinuitFcnGrad::MinuitFcnGrad(const std::shared_ptr<RooFit::TestStatistics::RooAbsL> &absL, RooMinimizer *context,
                              std::vector<ROOT::Fit::ParameterSettings> &parameters, LikelihoodMode likelihoodMode,
-                             LikelihoodGradientMode likelihoodGradientMode)
+                             LikelihoodGradientMode likelihoodGradientMode, std::size_t nThreads)
    : RooAbsMinimizerFcn(*absL->getParameters(), context),
      _minuitInternalX(NDim(), 0),
      _minuitExternalX(NDim(), 0),
@@ -100,7 +102,7 @@ MinuitFcnGrad::MinuitFcnGrad(const std::shared_ptr<RooFit::TestStatistics::RooAb
       _likelihoodInGradient =
          LikelihoodWrapper::create(LikelihoodMode::serial, absL, _calculationIsClean, shared_offset);
    } else {
-      _likelihood = LikelihoodWrapper::create(likelihoodMode, absL, _calculationIsClean, shared_offset);
+      _likelihood = LikelihoodWrapper::create(likelihoodMode, absL, _calculationIsClean, shared_offset, nThreads);
       _likelihoodInGradient = _likelihood;
    }
 
@@ -32,7 +32,7 @@ class MinuitFcnGrad : public RooAbsMinimizerFcn {
 public:
    MinuitFcnGrad(const std::shared_ptr<RooFit::TestStatistics::RooAbsL> &absL, RooMinimizer *context,
                  std::vector<ROOT::Fit::ParameterSettings> &parameters, LikelihoodMode likelihoodMode,
-                 LikelihoodGradientMode likelihoodGradientMode);
+                 LikelihoodGradientMode likelihoodGradientMode, std::size_t nThreads = 0);
 
    /// Overridden from RooAbsMinimizerFcn to include gradient strategy synchronization.
    bool Synchronize(std::vector<ROOT::Fit::ParameterSettings> &parameter_settings) override;
@@ -0,0 +1,115 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooFit/TestStatistics/LikelihoodWrapper.h>
+#include <RooFit/TestStatistics/RooRealL.h>
+#include <RooFit/TestStatistics/buildLikelihood.h>
+
+#include <RooCategory.h>
+#include <RooDataSet.h>
+#include <RooFitResult.h>
+#include <RooHelpers.h>
+#include <RooMinimizer.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+#include <RooWorkspace.h>
+
+#include "gtest/gtest.h"
+
+using RooFit::TestStatistics::LikelihoodMode;
+using RooFit::TestStatistics::LikelihoodWrapper;
+
+namespace {
+
+// Simultaneous model with four unbinned channels that share the width, so
+// that there are several components to evaluate concurrently.
+std::unique_ptr<RooWorkspace> makeSimUnbinnedWorkspace()
+{
+   auto ws = std::make_unique<RooWorkspace>();
+   RooWorkspace &w = *ws;
+   w.factory("Gaussian::gA(x[-10,10],mA[2,-10,10],s[3,0.1,10])");
+   w.factory("Gaussian::gB(x,mB[-2,-10,10],s)");
+   w.factory("Gaussian::gC(x,mC[0,-10,10],s)");
+   w.factory("Gaussian::gD(x,mD[4,-10,10],s)");
+   w.factory("SIMUL::model(index[A,B,C,D],A=gA,B=gB,C=gC,D=gD)");
+
+   std::unique_ptr<RooDataSet> data{w.pdf("model")->generate({*w.var("x"), *w.cat("index")}, 4000)};
+   w.import(*data, RooFit::Rename("data"));
+   return ws;
+}
+
+} // namespace
+
+TEST(LikelihoodThreads, SameResultAsSerial)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooRandom::randomGenerator()->SetSeed(23);
+
+   std::unique_ptr<RooWorkspace> ws = makeSimUnbinnedWorkspace();
+   RooAbsPdf *pdf = ws->pdf("model");
+   RooAbsData *data = ws->data("data");
+
+   // Separate likelihoods, such that the components do not return the values cached by the other wrapper.
+   auto cleanFlags = std::make_shared<RooFit::TestStatistics::WrapperCalculationCleanFlags>();
+   SharedOffset offset;
+   auto serial = LikelihoodWrapper::create(LikelihoodMode::serial, RooFit::TestStatistics::buildLikelihood(pdf, data),
+                                           cleanFlags, offset);
+   auto threads = LikelihoodWrapper::create(LikelihoodMode::multithreadComponents,
+                                            RooFit::TestStatistics::buildLikelihood(pdf, data), cleanFlags, offset, 4);
+
+   // The first evaluation runs serially, the second one on the threads.
+   for (int i = 0; i < 2; ++i) {
+      ws->var("mB")->setVal(-2. + 0.1 * i);
+      serial->evaluate();
+      threads->evaluate();
+      EXPECT_EQ(serial->getResult().Sum(), threads->getResult().Sum());
+   }
+}
+
+TEST(LikelihoodThreads, Minimize)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooRandom::randomGenerator()->SetSeed(23);
+
+   std::unique_ptr<RooWorkspace> ws = makeSimUnbinnedWorkspace();
+   RooAbsPdf *pdf = ws->pdf("model");
+   RooAbsData *data = ws->data("data");
+
+   std::unique_ptr<RooArgSet> params{pdf->getParameters(*data)};
+   RooArgSet initialValues;
+   params->snapshot(initialValues);
+
+   // reference fit with the classic likelihood
+   std::unique_ptr<RooAbsReal> nll{pdf->createNLL(*data)};
+   RooMinimizer m0(*nll);
+   m0.setPrintLevel(-1);
+   m0.minimize("Minuit2", "migrad");
+   std::unique_ptr<RooFitResult> result0{m0.save()};
+
+   params->assign(initialValues);
+
+   RooFit::TestStatistics::RooRealL likelihood("likelihood", "likelihood",
+                                               RooFit::TestStatistics::buildLikelihood(pdf, data));
+   RooMinimizer::Config cfg;
+   cfg.parallelize = 4;
+   cfg.parallelizeComponentsWithThreads = true;
+   RooMinimizer m1(likelihood, cfg);
+   m1.setPrintLevel(-1);
+   m1.minimize("Minuit2", "migrad");
+   std::unique_ptr<RooFitResult> result1{m1.save()};
+
+   EXPECT_EQ(result1->status(), 0);
+   EXPECT_NEAR(result0->minNll(), result1->minNll(), 1e-6);
+   for (auto const *name : {"mA", "mB", "mC", "mD", "s"}) {
+      auto const &par0 = static_cast<RooRealVar const &>(*result0->floatParsFinal().find(name));
+      auto const &par1 = static_cast<RooRealVar const &>(*result1->floatParsFinal().find(name));
+      EXPECT_NEAR(par0.getVal(), par1.getVal(), 1e-3 * par0.getError()) << name;
+   }
+}
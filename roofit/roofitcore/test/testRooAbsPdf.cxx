@@ -24,7 +24,9 @@
 
 #include "gtest_wrapper.h"
 
+#include <cmath>
 #include <memory>
+#include <vector>
 
 class FitTest : public testing::TestWithParam<std::tuple<RooFit::EvalBackend>> {
 public:
@@ -397,6 +399,62 @@ TEST(RooAbsPdf, NormSetChange)
    EXPECT_NE(v1, v2);
 }
 
+#ifndef _WIN32
+// Generating the events in several processes is reproducible, gives different
+// events in each process, and samples the same distribution as the serial
+// generation.
+TEST(RooAbsPdf, GenerateMultiProcess)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::gauss(x[0, -10, 10], mu[1., -10, 10], sigma[2., 0.1, 10.])");
+   ws.factory("ExtendPdf::pdf(gauss, nEvents[1000., 0., 100000.])");
+
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &pdf = *ws.pdf("pdf");
+
+   auto generate = [&](RooCmdArg const &arg1, RooCmdArg const &arg2 = RooCmdArg::none()) {
+      RooRandom::randomGenerator()->SetSeed(1337ul);
+      return std::unique_ptr<RooDataSet>{pdf.generate(x, arg1, arg2)};
+   };
+
+   const int nEvents = 3001;
+   std::unique_ptr<RooDataSet> data1 = generate(NumEvents(nEvents), NumCPU(3));
+   std::unique_ptr<RooDataSet> data2 = generate(NumEvents(nEvents), NumCPU(3));
+   ASSERT_NE(data1, nullptr);
+   ASSERT_NE(data2, nullptr);
+   ASSERT_EQ(data1->numEntries(), nEvents);
+   ASSERT_EQ(data2->numEntries(), nEvents);
+   EXPECT_TRUE(data1->get()->find("x"));
+
+   std::vector<double> values(nEvents);
+   for (int i = 0; i < nEvents; ++i) {
+      values[i] = data1->get(i)->getRealValue("x");
+      EXPECT_EQ(data2->get(i)->getRealValue("x"), values[i]);
+   }
+
+   // the chunks of 1001, 1000 and 1000 events are generated with different seeds
+   EXPECT_NE(std::vector<double>(values.begin(), values.begin() + 10),
+             std::vector<double>(values.begin() + 1001, values.begin() + 1011));
+   EXPECT_NE(std::vector<double>(values.begin() + 1001, values.begin() + 1011),
+             std::vector<double>(values.begin() + 2001, values.begin() + 2011));
+
+   // the generated distribution is the one of the model
+   EXPECT_NEAR(data1->mean(x), 1., 5. * 2. / std::sqrt(nEvents));
+   EXPECT_NEAR(data1->sigma(x), 2., 5. * 2. / std::sqrt(2. * nEvents));
+
+   // the extended mode fluctuates the total number of events only once, with the first random number like the
+   // serial generation
+   std::unique_ptr<RooDataSet> dataExtended = generate(Extended(), NumCPU(3));
+   ASSERT_NE(dataExtended, nullptr);
+   RooRandom::randomGenerator()->SetSeed(1337ul);
+   EXPECT_EQ(dataExtended->numEntries(), static_cast<int>(RooRandom::randomGenerator()->Poisson(1000.)));
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(RooAbsPdf, FitTest, testing::Values(ROOFIT_EVAL_BACKENDS),
                          [](testing::TestParamInfo<FitTest::ParamType> const &paramInfo) {
                             std::stringstream ss;
@@ -35,10 +35,12 @@
 #include <RooWorkspace.h>
 
 #include <ROOT/StringUtils.hxx>
+#include <TEnv.h>
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TMath.h>
 
+#include <filesystem>
 #include <functional>
 #include <random>
 
@@ -166,6 +168,76 @@ TEST(RooFuncWrapper, Exponential)
    }
 }
 
+/// A function exported with exportLibrary() is loaded by the next RooFuncWrapper of the same model instead of being
+/// jitted, also for a dataset of another size.
+TEST(RooFuncWrapper, ExportLibrary)
+{
+   using RooFit::Experimental::RooFuncWrapper;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::model(x[0, -10, 10], mu[0.5, -10, 10], sigma[2.0, 0.01, 10])");
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &model = *ws.pdf("model");
+
+   std::unique_ptr<RooDataSet> data1{model.generate(x, 100)};
+   std::unique_ptr<RooDataSet> data2{model.generate(x, 150)};
+
+   const std::string oldDirectory = gEnv->GetValue("RooFit.Codegen.LibraryDir", "");
+   const std::string directory =
+      std::string(gSystem->TempDirectory()) + "/RooFuncWrapperExportLibrary_" + std::to_string(gSystem->GetPid());
+
+   // Without library directory, the generated code depends on the data and can't be exported.
+   gEnv->SetValue("RooFit.Codegen.LibraryDir", "");
+   {
+      std::unique_ptr<RooAbsReal> nll{model.createNLL(*data1, RooFit::EvalBackend::Codegen())};
+      RooHelpers::LocalChangeMsgLevel changeMsgLvlErr(RooFit::FATAL);
+      EXPECT_FALSE(static_cast<RooFuncWrapper &>(*nll).exportLibrary(directory));
+   }
+
+   // The library doesn't exist yet, so these are jitted.
+   gEnv->SetValue("RooFit.Codegen.LibraryDir", directory.c_str());
+   std::unique_ptr<RooAbsReal> nllJitted1{model.createNLL(*data1, RooFit::EvalBackend::Codegen())};
+   std::unique_ptr<RooAbsReal> nllJitted2{model.createNLL(*data2, RooFit::EvalBackend::Codegen())};
+   auto &jitted1 = static_cast<RooFuncWrapper &>(*nllJitted1);
+   auto &jitted2 = static_cast<RooFuncWrapper &>(*nllJitted2);
+
+   // The generated code doesn't depend on the number of entries.
+   EXPECT_EQ(jitted1.codeHash(), jitted2.codeHash());
+
+   ASSERT_TRUE(jitted1.exportLibrary(directory));
+
+   for (RooFuncWrapper *jitted : {&jitted1, &jitted2}) {
+      RooAbsData &data = jitted == &jitted1 ? *data1 : *data2;
+      std::unique_ptr<RooAbsReal> nllLoaded;
+      {
+         RooHelpers::HijackMessageStream hijack(RooFit::INFO, RooFit::Fitting);
+         nllLoaded = std::unique_ptr<RooAbsReal>{model.createNLL(data, RooFit::EvalBackend::Codegen())};
+         EXPECT_NE(hijack.str().find("using the compiled function in " + directory), std::string::npos)
+            << hijack.str();
+      }
+      auto &loaded = static_cast<RooFuncWrapper &>(*nllLoaded);
+      EXPECT_EQ(loaded.codeHash(), jitted->codeHash());
+
+      jitted->disableEvaluator();
+      loaded.disableEvaluator();
+      EXPECT_DOUBLE_EQ(loaded.getVal(), jitted->getVal());
+
+      std::vector<double> gradJitted(jitted->getNumParams());
+      std::vector<double> gradLoaded(loaded.getNumParams());
+      jitted->gradient(gradJitted.data());
+      loaded.gradient(gradLoaded.data());
+      ASSERT_EQ(gradLoaded.size(), gradJitted.size());
+      for (std::size_t i = 0; i < gradJitted.size(); ++i) {
+         EXPECT_NEAR(gradLoaded[i], gradJitted[i], 1e-8 * std::abs(gradJitted[i]));
+      }
+   }
+
+   gEnv->SetValue("RooFit.Codegen.LibraryDir", oldDirectory.c_str());
+   std::filesystem::remove_all(directory);
+}
+
 using CreateNLLFunc =
    std::function<std::unique_ptr<RooAbsReal>(RooAbsPdf &, RooAbsData &, RooWorkspace &, RooFit::EvalBackend)>;
 using WorkspaceSetupFunc = std::function<void(RooWorkspace &)>;
@@ -214,6 +286,8 @@ std::unique_ptr<RooFitResult> runMinimizer(RooAbsReal &absReal, bool useGradient
    m.setPrintLevel(-1);
    m.setStrategy(0);
    m.minimize("Minuit2");
+   // With the AD gradient, Hesse computes the second derivatives from it.
+   m.hesse();
    return std::unique_ptr<RooFitResult>{m.save()};
 }
 
@@ -755,3 +755,36 @@ TEST(NLL, SetData)
    // 0.5, so this is what we analytically expect.
    EXPECT_DOUBLE_EQ(valSimB, valSimA + 0.5);
 }
+
+// Test that the multi-threaded evaluation with NumCPU() in the cpu backend
+// gives the same likelihood as the single-threaded one, and that the result
+// doesn't depend on the number of threads.
+TEST(NLL, NumCPUThreads)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace workspace;
+   workspace.factory("Gaussian::sig(x[-10, 10], mu[0, -10, 10], sigma[1, 0.1, 10])");
+   workspace.factory("Exponential::bkg(x, c[-0.2, -1, 0])");
+   workspace.factory("SUM::model(fsig[0.3, 0, 1] * sig, bkg)");
+
+   RooAbsPdf &model = *workspace.pdf("model");
+   RooRealVar &x = *workspace.var("x");
+   RooRealVar &mu = *workspace.var("mu");
+
+   RooRandom::randomGenerator()->SetSeed(1337);
+   // enough events to be split in several chunks
+   std::unique_ptr<RooDataSet> data{model.generate(x, 200000)};
+
+   using RooFit::EvalBackend;
+   std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, EvalBackend::Cpu())};
+   std::unique_ptr<RooAbsReal> nll3{model.createNLL(*data, EvalBackend::Cpu(), RooFit::NumCPU(3))};
+   std::unique_ptr<RooAbsReal> nll4{model.createNLL(*data, EvalBackend::Cpu(), RooFit::NumCPU(4))};
+
+   for (double muVal : {0.0, 0.5, -1.0}) {
+      mu.setVal(muVal);
+      const double ref = nll->getVal();
+      EXPECT_NEAR(nll4->getVal(), ref, 1e-12 * std::abs(ref));
+      EXPECT_EQ(nll3->getVal(), nll4->getVal());
+   }
+}
@@ -229,12 +229,26 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Generate and evaluate the toys in `n` parallel processes (not on Windows).
+      /// The toys are split in tasks of fixed size (see SetNToysPerTask()). Each toy
+      /// is generated with its own seed, derived from the state of
+      /// RooRandom::randomGenerator() at the start and the index of the toy.
+      /// Therefore, the results are the same as in serial runs, for any number of
+      /// processes and any task size.
+      void SetNWorkers(unsigned int n) { fNWorkers = n; }
+      unsigned int GetNWorkers() const { return fNWorkers; }
+      /// Number of toys of a task in parallel runs.
+      void SetNToysPerTask(unsigned int n) { fNToysPerTask = n > 0 ? n : 1; }
+      unsigned int GetNToysPerTask() const { return fNToysPerTask; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
 
       const RooArgList* EvaluateAllTestStatistics(RooAbsData& data, const RooArgSet& poi, DetailedOutputAggregator& detOutAgg);
 
+      RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
+
       /// helper for GenerateToyData
       std::unique_ptr<RooAbsData> Generate(RooAbsPdf &pdf, RooArgSet &observables, const RooDataSet *protoData=nullptr, int forceEvents=0) const;
 
@@ -275,6 +289,10 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData = nullptr; ///< in dev
 
       ProofConfig *fProofConfig = nullptr; ///<!
+      unsigned int fNWorkers = 1;          ///<! number of processes for parallel runs
+      unsigned int fNToysPerTask = 10;     ///<! number of toys per task in parallel runs
+      ULong_t fToySeedBase = 0;            ///<! seed of the first toy of the next run, 0 to draw it
+      Int_t fFirstToy = 0;                 ///<! index of the first toy of the next run
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler = nullptr; ///<!
 
@@ -27,6 +27,13 @@ TestStatistic.
 For parallel runs, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
+
+Alternatively, the toys can be generated and evaluated in several processes
+forked from the current one with SetNWorkers(). Each process works with its own
+copy of the model, so no thread safety is required from the test statistics.
+The toys are split in tasks of SetNToysPerTask() toys. Each toy seeds the random
+generator with a seed derived from its index, so the results are the same as in
+serial runs and don't depend on the number of processes or on the task size.
 */
 
 #include "RooStats/ToyMCSampler.h"
@@ -50,6 +57,13 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef _WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <string>
 
 using namespace RooFit;
 using std::endl;
@@ -266,6 +280,10 @@ SamplingDistribution* ToyMCSampler::GetSamplingDistribution(RooArgSet& paramPoin
 RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
+   // ======= M U L T I - P R O C E S S   R U N ? =======
+   if(!fProofConfig && fNWorkers > 1)
+      return GetSamplingDistributionsMultiProcess(paramPointIn);
+
    // ======= S I N G L E   R U N ? =======
    if(!fProofConfig)
       return GetSamplingDistributionsSingleWorker(paramPointIn);
@@ -309,6 +327,88 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Runs the toys in fNWorkers forked processes. Each task calls
+/// GetSamplingDistributionsSingleWorker() for fNToysPerTask toys, starting at
+/// the index of its first toy, such that the toys are seeded as in a serial run.
+/// The results are merged in the order of the tasks.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef _WIN32
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: multi-process runs are not supported on Windows, generating the toys serially." << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   // the expected nuisance parameter points are a grid that has to be walked
+   // through by a single worker
+   if (fPriorNuisance && fExpectedNuisancePar) {
+      oocoutW(nullptr, InputArguments)
+         << "ToyMCSampler: expected nuisance parameters are not supported for multi-process runs, "
+            "generating the toys serially." << endl;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
+
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fNToys;
+   if (totToys <= 0) return GetSamplingDistributionsSingleWorker(paramPointIn);
+   const unsigned int nTasks = (totToys + fNToysPerTask - 1) / fNToysPerTask;
+   // the same seeds as GetSamplingDistributionsSingleWorker() draws in a serial run
+   TRandom *random = RooRandom::randomGenerator();
+   const ULong_t seedBase = random->Integer(TMath::Limits<unsigned int>::Max());
+   const ULong_t nextSeed = random->Integer(TMath::Limits<unsigned int>::Max()) + 1;
+
+   // Runs in the forked processes, which have their own copy of this sampler
+   // and the model.
+   auto runTask = [&](unsigned int iTask) -> RooDataSet * {
+      fToySeedBase = seedBase;
+      fFirstToy = iTask * fNToysPerTask;
+      fNToys = std::min<Int_t>(fNToysPerTask, totToys - fFirstToy);
+      RooDataSet *result = GetSamplingDistributionsSingleWorker(paramPointIn);
+      // the results are not received in order, so we pass the task index in the name
+      if (result) result->SetName(std::to_string(iTask).c_str());
+      return result;
+   };
+
+   ROOT::TProcessExecutor executor(std::min(fNWorkers, nTasks));
+   std::vector<RooDataSet *> results = executor.Map(runTask, ROOT::TSeq<unsigned int>(nTasks));
+   random->SetSeed(nextSeed);
+
+   results.erase(std::remove(results.begin(), results.end(), nullptr), results.end());
+   std::sort(results.begin(), results.end(), [](RooDataSet *a, RooDataSet *b) {
+      return std::stoul(a->GetName()) < std::stoul(b->GetName());
+   });
+   if (results.size() != nTasks) {
+      oocoutW(nullptr, Generation) << "ToyMCSampler: only " << results.size() << " out of " << nTasks
+                                   << " tasks returned a result." << endl;
+   }
+   if (results.empty()) return nullptr;
+
+   RooDataSet *output = results[0];
+   output->SetNameTitle(fSamplingDistName.c_str(), fSamplingDistName.c_str());
+   for (std::size_t i = 1; i < results.size(); ++i) {
+      output->append(*results[i]);
+      delete results[i];
+   }
+
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -345,6 +445,21 @@ RooDataSet* ToyMCSampler::GetSamplingDistributionsSingleWorker(RooArgSet& paramP
    // (taking weights into account; always on first test statistic)
    double toysInTails = 0.0;
 
+   // Each toy is generated with its own seed, derived from its index, such that the toys don't depend on how they
+   // are split in the tasks of multi-process runs. The seeds of a task are given by
+   // GetSamplingDistributionsMultiProcess() and only used for its first run. After a serial run, the random
+   // generator continues with a seed that doesn't depend on the toys.
+   TRandom *random = RooRandom::randomGenerator();
+   ULong_t seedBase = fToySeedBase;
+   ULong_t nextSeed = 0;
+   const Int_t firstToy = fFirstToy;
+   if (seedBase == 0) {
+      seedBase = random->Integer(TMath::Limits<unsigned int>::Max());
+      nextSeed = random->Integer(TMath::Limits<unsigned int>::Max()) + 1;
+   }
+   fToySeedBase = 0;
+   fFirstToy = 0;
+
    for (Int_t i = 0; i < fMaxToys; ++i) {
       // need to check at the beginning for case that zero toys are requested
       if (toysInTails >= fToysInTails  &&  i+1 > fNToys) break;
@@ -362,6 +477,15 @@ RooDataSet* ToyMCSampler::GetSamplingDistributionsSingleWorker(RooArgSet& paramP
       double valueFirst = -999.0;
       double weight = 1.0;
 
+      // seeds are in [1, 2^32 - 1], a seed of zero would make TRandom3 choose a random seed
+      random->SetSeed((static_cast<ULong64_t>(seedBase) + firstToy + i) % 4294967295ULL + 1);
+      // with a prior, each toy also gets its own nuisance parameter point. The expected
+      // nuisance parameters are a grid that is walked through by all toys.
+      if (fPriorNuisance && fNuisancePars && !fExpectedNuisancePar) {
+         delete fNuisanceParametersSampler;
+         fNuisanceParametersSampler = new NuisanceParametersSampler(fPriorNuisance, fNuisancePars, 1, false);
+      }
+
       // set variables to requested parameter point
       allVars->assign(*saveAll); // important for example for SimpleLikelihoodRatioTestStat
 
@@ -403,6 +527,7 @@ RooDataSet* ToyMCSampler::GetSamplingDistributionsSingleWorker(RooArgSet& paramP
 
    // clean up
    allVars->assign(*saveAll);
+   if (nextSeed != 0) random->SetSeed(nextSeed);
 
    return detOutAgg.GetAsDataSet(fSamplingDistName, fSamplingDistName);
 }
@@ -0,0 +1,89 @@
+#include "RooRealVar.h"
+#include "RooGaussian.h"
+#include "RooExtendPdf.h"
+#include "RooRandom.h"
+#include "RooStats/NumEventsTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+#ifndef _WIN32
+namespace {
+
+/// Runs the toys of an extended Gaussian model, with the number of events as test statistic.
+class ToyMCSamplerMultiProcess : public testing::Test {
+protected:
+   std::vector<double> run(unsigned int nWorkers, unsigned int nToysPerTask)
+   {
+      RooStats::ToyMCSampler sampler(testStat, nToys);
+      sampler.SetPdf(pdf);
+      sampler.SetObservables(observables);
+      sampler.SetParametersForTestStat(poi);
+      sampler.SetNWorkers(nWorkers);
+      sampler.SetNToysPerTask(nToysPerTask);
+      RooRandom::randomGenerator()->SetSeed(1234);
+      std::unique_ptr<RooStats::SamplingDistribution> sd{sampler.GetSamplingDistribution(poi)};
+      EXPECT_NE(sd, nullptr);
+      return sd ? sd->GetSamplingDistribution() : std::vector<double>{};
+   }
+
+   RooRealVar x{"x", "x", 0., -5., 5.};
+   RooRealVar mu{"mu", "mu", 0., -5., 5.};
+   RooRealVar sigma{"sigma", "sigma", 1.};
+   RooGaussian gauss{"gauss", "gauss", x, mu, sigma};
+   RooRealVar nEvents{"nEvents", "nEvents", 50., 0., 1000.};
+   RooExtendPdf pdf{"pdf", "pdf", gauss, nEvents};
+
+   RooStats::NumEventsTestStat testStat{pdf};
+   RooArgSet observables{x};
+   RooArgSet poi{mu};
+
+   static constexpr int nToys = 25;
+};
+
+} // namespace
+
+// The results of multi-process runs only depend on the seed, but not on the number of processes.
+TEST_F(ToyMCSamplerMultiProcess, Reproducible)
+{
+   std::vector<double> sd2 = run(2, 4);
+   std::vector<double> sd3 = run(3, 4);
+
+   ASSERT_EQ(sd2.size(), std::size_t(nToys));
+   EXPECT_EQ(sd3, sd2);
+}
+
+// Each task generates its own toys, i.e. the toys of different tasks have different seeds.
+TEST_F(ToyMCSamplerMultiProcess, DifferentToysPerTask)
+{
+   const unsigned int nToysPerTask = 5;
+   std::vector<double> sd = run(2, nToysPerTask);
+   ASSERT_EQ(sd.size(), std::size_t(nToys));
+
+   for (std::size_t i = 0; i < sd.size(); i += nToysPerTask) {
+      for (std::size_t j = i + nToysPerTask; j < sd.size(); j += nToysPerTask) {
+         EXPECT_NE(std::vector<double>(sd.begin() + i, sd.begin() + i + nToysPerTask),
+                   std::vector<double>(sd.begin() + j, sd.begin() + j + nToysPerTask))
+            << "tasks starting at toys " << i << " and " << j;
+      }
+   }
+}
+
+// Each toy has its own seed, so the toys are the same as in a serial run for any task size.
+TEST_F(ToyMCSamplerMultiProcess, TaskSizeKeepsToys)
+{
+   std::vector<double> serial = run(1, 4);
+   std::vector<double> sd4 = run(2, 4);
+   std::vector<double> sd5 = run(3, 5);
+   std::vector<double> sd25 = run(2, nToys);
+
+   ASSERT_EQ(serial.size(), std::size_t(nToys));
+   EXPECT_EQ(sd4, serial);
+   EXPECT_EQ(sd5, serial);
+   EXPECT_EQ(sd25, serial);
+}
+#endif
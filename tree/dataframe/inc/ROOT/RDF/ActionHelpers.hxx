@@ -37,6 +37,10 @@
 #include "TError.h" // for R__ASSERT, Warning
 #include "TFile.h" // for SnapshotHelper
 #include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
 #include "TGraph.h"
 #include "TGraphAsymmErrors.h"
 #include "TLeaf.h"
@@ -57,6 +61,7 @@
 #include <utility> // std::index_sequence
 #include <vector>
 #include <iomanip>
+#include <iterator> // std::make_move_iterator
 #include <numeric> // std::accumulate in MeanHelper
 
 /// \cond HIDDEN_SYMBOLS
@@ -345,6 +350,66 @@ template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
 
+   // TH1D, TH2D, TH3D, TProfile and TProfile2D (the results of Histo1D/2D/3D and Profile1D/2D) are filled in batches:
+   // the values passed to Fill are buffered per slot and handed over to FillN, which looks up the bins of a whole
+   // batch at once. fgNCoords is the number of values of an entry before the optional weight.
+   static constexpr std::size_t fgNCoords = std::is_same<HIST, ::TH1D>::value         ? 1
+                                            : std::is_same<HIST, ::TH2D>::value       ? 2
+                                            : std::is_same<HIST, ::TProfile>::value   ? 2
+                                            : std::is_same<HIST, ::TH3D>::value       ? 3
+                                            : std::is_same<HIST, ::TProfile2D>::value ? 3
+                                                                                      : 0;
+   static constexpr std::size_t fgBatchSize = 1024; // entries
+   struct RFillBatch {
+      std::vector<double> fValues; ///< Values of each entry (coordinates, then optionally the weight), interleaved
+      std::size_t fValuesPerEntry = 0;
+   };
+   std::vector<RFillBatch> fBatches;
+
+   // Values can be batched if they match the FillN(x[, y[, z]], w) signature of the histogram or profile
+   template <typename... Vs>
+   static constexpr bool CanBatch()
+   {
+      return fgNCoords > 0 && (sizeof...(Vs) == fgNCoords || sizeof...(Vs) == fgNCoords + 1) &&
+             (std::is_arithmetic<Vs>::value && ...);
+   }
+
+   template <typename... Vs>
+   void FillOne(unsigned int slot, const Vs &...vs)
+   {
+      if constexpr (CanBatch<Vs...>()) {
+         auto &batch = fBatches[slot];
+         if (batch.fValues.empty())
+            batch.fValues.reserve(fgBatchSize * sizeof...(Vs));
+         batch.fValuesPerEntry = sizeof...(Vs);
+         (batch.fValues.push_back(static_cast<double>(vs)), ...);
+         if (batch.fValues.size() >= fgBatchSize * sizeof...(Vs))
+            FlushBatch(slot);
+      } else {
+         fObjects[slot]->Fill(vs...);
+      }
+   }
+
+   void FlushBatch(unsigned int slot)
+   {
+      if constexpr (fgNCoords > 0) {
+         auto &batch = fBatches[slot];
+         if (batch.fValues.empty())
+            return;
+         const auto stride = batch.fValuesPerEntry;
+         const auto nEntries = static_cast<Int_t>(batch.fValues.size() / stride);
+         const double *v = batch.fValues.data();
+         const double *w = stride > fgNCoords ? v + fgNCoords : nullptr;
+         if constexpr (fgNCoords == 1)
+            fObjects[slot]->FillN(nEntries, v, w, stride);
+         else if constexpr (fgNCoords == 2)
+            fObjects[slot]->FillN(nEntries, v, v + 1, w, stride);
+         else
+            fObjects[slot]->FillN(nEntries, v, v + 1, v + 2, w, stride);
+         batch.fValues.clear();
+      }
+   }
+
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
    {
@@ -444,12 +509,11 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    template <std::size_t ColIdx, typename End_t, typename... Its>
    void ExecLoop(unsigned int slot, End_t end, Its... its)
    {
-      auto *thisSlotH = fObjects[slot];
       // loop increments all of the iterators while leaving scalars unmodified
       // TODO this could be simplified with fold expressions or std::apply in C++17
       auto nop = [](auto &&...) {};
       for (; GetNthElement<ColIdx>(its...) != end; nop(++its...)) {
-         thisSlotH->Fill(*its...);
+         FillOne(slot, *its...);
       }
    }
 
@@ -457,7 +521,7 @@ public:
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
 
-   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr), fBatches(nSlots)
    {
       fObjects[0] = h.get();
       // Initialize all other slots
@@ -473,7 +537,7 @@ public:
    template <typename... ValTypes, std::enable_if_t<!Disjunction<IsDataContainer<ValTypes>...>::value, int> = 0>
    auto Exec(unsigned int slot, const ValTypes &...x) -> decltype(fObjects[slot]->Fill(x...), void())
    {
-      fObjects[slot]->Fill(x...);
+      FillOne(slot, x...);
    }
 
    // at least one container argument
@@ -515,17 +579,31 @@ public:
 
    void Finalize()
    {
+      for (unsigned int slot = 0; slot < fObjects.size(); ++slot)
+         FlushBatch(slot);
+
       if (fObjects.size() == 1)
          return;
 
-      Merge(fObjects, /*toselectcorrectoverload=*/0);
+      // Merging all partial results into the first one serially can take longer than the event loop itself for
+      // large objects and many slots: merge pairs of them instead, concurrently if possible.
+      TreeMerge(fObjects.size(), [this](unsigned int to, unsigned int from) {
+         // objects created while merging must not end up in the current directory of the worker thread
+         TDirectory::TContext ctx(nullptr);
+         std::vector<HIST *> pair{fObjects[to], fObjects[from]};
+         Merge(pair, /*toselectcorrectoverload=*/0);
+      });
 
       // delete the copies we created for the slots other than the first
       for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
          delete *it;
    }
 
-   HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      FlushBatch(slot);
+      return *fObjects[slot];
+   }
 
    // Helper functions for RMergeableValue
    std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
@@ -851,9 +929,10 @@ public:
          totSize += coll->size();
       auto rColl = fColls[0];
       rColl->reserve(totSize);
+      // the per-slot collections are not used after this point, so we can move their contents
       for (unsigned int i = 1; i < fColls.size(); ++i) {
          auto &coll = fColls[i];
-         rColl->insert(rColl->end(), coll->begin(), coll->end());
+         rColl->insert(rColl->end(), std::make_move_iterator(coll->begin()), std::make_move_iterator(coll->end()));
       }
    }
 
@@ -899,7 +978,7 @@ public:
       for (unsigned int i = 1; i < fColls.size(); ++i) {
          auto &coll = fColls[i];
          for (auto &v : *coll) {
-            rColl->emplace_back(v);
+            rColl->emplace_back(std::move(v));
          }
       }
    }
@@ -950,9 +1029,10 @@ public:
          totSize += coll->size();
       auto rColl = fColls[0];
       rColl->reserve(totSize);
+      // the per-slot collections are not used after this point, so we can move their contents
       for (unsigned int i = 1; i < fColls.size(); ++i) {
          auto &coll = fColls[i];
-         rColl->insert(rColl->end(), coll->begin(), coll->end());
+         rColl->insert(rColl->end(), std::make_move_iterator(coll->begin()), std::make_move_iterator(coll->end()));
       }
    }
 
@@ -21,6 +21,8 @@
 namespace ROOT {
 namespace Internal {
 namespace RDF {
+class RNodeProfile;
+
 namespace GraphDrawing {
 
 enum class ENodeType {
@@ -57,6 +59,9 @@ class GraphNode {
 
    std::shared_ptr<GraphNode> fPrevNode;
 
+   /// Profiling information of the corresponding RDF node, if it was profiled (see EnableProfiling).
+   const RNodeProfile *fProfile = nullptr;
+
    /// When the graph is reconstructed, the first time this node has been explored this flag
    /// is set and it won't be explored anymore.
    bool fIsExplored = false;
@@ -145,11 +150,16 @@ public:
       };
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Attaches the profiling information of the corresponding RDF node, null if not profiled
+   void SetProfile(const RNodeProfile *profile) { fProfile = profile; }
+
    std::string GetColor() const { return fColor; }
    unsigned int GetID() const { return fID; }
    std::string GetName() const { return fName; }
    std::string GetShape() const { return fShape; }
    GraphNode *GetPrevNode() const { return fPrevNode.get(); }
+   const RNodeProfile *GetProfile() const { return fProfile; }
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Gets the column defined up to the node
@@ -77,6 +77,10 @@ public:
    /// \brief Starting from the root node, prints the entire graph.
    std::string RepresentGraph(RLoopManager *rLoopManager);
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the profile of the last event loop as a Chrome trace, see RLoopProfiler.
+   std::string RepresentProfile(RLoopManager *rLoopManager);
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from a Filter or Range, prints the branch it belongs to
    template <typename Proxied, typename DataSource>
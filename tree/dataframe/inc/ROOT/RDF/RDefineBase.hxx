@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,7 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   std::unique_ptr<RDFInternal::RNodeProfile> fProfile; ///< Null unless profiling is enabled
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,6 +64,13 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   /// Return the names of the input columns of this Define.
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   /// Return the register of the columns that were available when this Define was booked.
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   void SetProfiling(RDFInternal::RLoopProfiler *profiler);
+   // overridden by RJittedDefine
+   virtual const RDFInternal::RNodeProfile *GetProfile() const { return fProfile.get(); }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
@@ -51,6 +51,7 @@ public:
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
+   bool HasUpstreamFilters() final;
    void FinalizeSlot(unsigned int) final;
    void Finalize() final;
    void *PartialUpdate(unsigned int slot) final;
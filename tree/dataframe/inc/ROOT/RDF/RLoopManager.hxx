@@ -14,6 +14,7 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
@@ -164,6 +165,12 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// Dataset columns that are only read for entries passing a Filter, see EvalDeferredBranches().
+   ColumnNames_t fDeferredBranches;
+
+   /// Event-loop profiling information, null unless EnableProfiling() was called.
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+
    ROOT::Internal::TreeUtils::RNoCleanupNotifier fNoCleanupNotifier;
 
    void RunEmptySourceMT();
@@ -178,6 +185,7 @@ class RLoopManager : public RNodeBase {
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
+   void EvalDeferredBranches();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
@@ -262,6 +270,9 @@ public:
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
    void ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec);
 
+   void EnableProfiling();
+   const RDFInternal::RLoopProfiler *GetProfiler() const { return fProfiler.get(); }
+
    ROOT::Internal::RDF::RStringCache &GetColumnNamesCache() { return fCachedColNames; }
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RDefinesWithReaders>>> &
    GetUniqueDefinesWithReaders()
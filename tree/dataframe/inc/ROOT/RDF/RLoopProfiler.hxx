@@ -0,0 +1,146 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RLOOPPROFILER
+#define ROOT_RDF_RLOOPPROFILER
+
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RNodeTimer;
+
+/// Per-slot counters of the time spent in and the entries processed by one node of the computation graph.
+/// Nodes only own one of these while profiling is enabled, see ROOT::RDF::Experimental::EnableProfiling.
+class RNodeProfile {
+   std::vector<ULong64_t> fNanoseconds; ///< Exclusive time spent in the node, per slot
+   std::vector<ULong64_t> fEntries;     ///< Number of entries processed by the node, per slot
+   ULong64_t fBytesRead = 0ull;         ///< Bytes read from storage, only filled for the data source
+   RNodeTimer **fCurrentTimers;         ///< Innermost running timer of each slot, owned by the RLoopProfiler
+
+public:
+   RNodeProfile(unsigned int nSlots, RNodeTimer **currentTimers)
+      : fNanoseconds(nSlots * CacheLineStep<ULong64_t>()),
+        fEntries(nSlots * CacheLineStep<ULong64_t>()),
+        fCurrentTimers(currentTimers)
+   {
+   }
+
+   void Add(unsigned int slot, ULong64_t nanoseconds, ULong64_t entries)
+   {
+      fNanoseconds[slot * CacheLineStep<ULong64_t>()] += nanoseconds;
+      fEntries[slot * CacheLineStep<ULong64_t>()] += entries;
+   }
+   void SetBytesRead(ULong64_t bytes) { fBytesRead = bytes; }
+
+   unsigned int GetNSlots() const { return fEntries.size() / CacheLineStep<ULong64_t>(); }
+   ULong64_t GetNanoseconds(unsigned int slot) const { return fNanoseconds[slot * CacheLineStep<ULong64_t>()]; }
+   ULong64_t GetEntries(unsigned int slot) const { return fEntries[slot * CacheLineStep<ULong64_t>()]; }
+   ULong64_t GetTotalNanoseconds() const;
+   ULong64_t GetTotalEntries() const;
+   /// The innermost running timer of a slot, shared by the profiles of all nodes of the event loop.
+   RNodeTimer *&CurrentTimer(unsigned int slot) { return fCurrentTimers[slot * CacheLineStep<RNodeTimer *>()]; }
+   ULong64_t GetBytesRead() const { return fBytesRead; }
+   /// A short human-readable summary, e.g. "12.3 ms, 1000 entries".
+   std::string GetSummary() const;
+};
+
+/// RAII timer that attributes to a RNodeProfile the time spent in its scope.
+/// Timers nest per slot: the time spent in inner timers (e.g. the Defines evaluated to read the inputs of a
+/// Filter) is only attributed to the inner nodes, so that each node is charged with its exclusive time.
+/// The nesting is tracked per slot and not per thread, since a thread can start the task of another slot while
+/// a task is suspended (e.g. with TBB work stealing), whereas the timers of one slot always stop in LIFO order.
+/// A timer constructed with a null profile does nothing.
+class RNodeTimer {
+   RNodeProfile *fProfile;
+   unsigned int fSlot = 0u;
+   ULong64_t fEntries = 0ull;
+   std::chrono::steady_clock::time_point fStart;
+   ULong64_t fNestedNanoseconds = 0ull;
+   RNodeTimer *fParent = nullptr;
+
+public:
+   RNodeTimer(RNodeProfile *profile, unsigned int slot, ULong64_t entries = 1ull) : fProfile(profile)
+   {
+      if (fProfile) {
+         fSlot = slot;
+         fEntries = entries;
+         fParent = std::exchange(fProfile->CurrentTimer(slot), this);
+         fStart = std::chrono::steady_clock::now();
+      }
+   }
+   RNodeTimer(const RNodeTimer &) = delete;
+   RNodeTimer &operator=(const RNodeTimer &) = delete;
+   ~RNodeTimer()
+   {
+      if (fProfile)
+         Stop();
+   }
+
+   void Stop();
+};
+
+/// Event-loop level profiling information, owned by the RLoopManager while profiling is enabled.
+/// Besides the per-node counters held by the nodes themselves, it records the time spent in each task and the time
+/// the tasks spent outside of any node (reading data and running the event loop), which is charged to the data
+/// source. It can export everything as a Chrome trace (the JSON format understood by chrome://tracing and Perfetto).
+class RLoopProfiler {
+   struct RTask {
+      ULong64_t fStart;   ///< Nanoseconds since the start of the event loop
+      ULong64_t fEnd;     ///< Nanoseconds since the start of the event loop
+      ULong64_t fEntries; ///< Entries processed by the task
+   };
+
+   const unsigned int fNSlots;
+   /// The innermost running timer of each slot, see RNodeProfile::CurrentTimer.
+   std::vector<RNodeTimer *> fCurrentTimers;
+   RNodeProfile fSourceProfile;
+   /// Tasks run by each slot during the last event loop.
+   std::vector<std::vector<RTask>> fTasks;
+   /// The timer of the task currently running in each slot, it encloses the timers of all nodes.
+   std::vector<std::unique_ptr<RNodeTimer>> fTaskTimers;
+   std::vector<ULong64_t> fTaskStartEntries;
+   std::chrono::steady_clock::time_point fLoopStart;
+   Long64_t fLoopStartBytesRead = 0ll;
+
+   ULong64_t NanosecondsSinceLoopStart() const;
+
+public:
+   explicit RLoopProfiler(unsigned int nSlots);
+
+   void StartLoop();
+   void StopLoop();
+   void StartTask(unsigned int slot);
+   void StopTask(unsigned int slot);
+   void CountEntry(unsigned int slot) { fSourceProfile.Add(slot, 0ull, 1ull); }
+   /// Create the profile of a node of the computation graph for the following event loops.
+   std::unique_ptr<RNodeProfile> MakeNodeProfile()
+   {
+      return std::make_unique<RNodeProfile>(fNSlots, fCurrentTimers.data());
+   }
+
+   const RNodeProfile &GetSourceProfile() const { return fSourceProfile; }
+   /// Return the profile of the last event loop in Chrome trace format.
+   /// \param[in] nodes Name and profile of each node of the computation graph that should appear in the trace.
+   std::string ToChromeTrace(const std::vector<std::pair<std::string, const RNodeProfile *>> &nodes) const;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RLOOPPROFILER
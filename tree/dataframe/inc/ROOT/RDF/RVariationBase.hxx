@@ -65,6 +65,9 @@ public:
    virtual void *GetValuePtr(unsigned int slot, const std::string &column, const std::string &variation) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    const std::vector<std::string> &GetColumnNames() const;
+   /// Return the names of the columns the varied values are computed from.
+   const ColumnNames_t &GetInputColumnNames() const { return fInputColumns; }
+   const RColumnRegister &GetColRegister() const { return fColumnRegister; }
    const std::vector<std::string> &GetVariationNames() const;
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
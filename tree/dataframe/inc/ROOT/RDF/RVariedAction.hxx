@@ -151,8 +151,10 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+         if (fPrevNodes[varIdx]->CheckFilters(slot, entry)) {
+            RNodeTimer timer(fProfile.get(), slot);
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
       }
    }
 
@@ -161,6 +163,15 @@ public:
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
    }
 
+   bool HasUpstreamFilters() final
+   {
+      return std::all_of(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) {
+         std::vector<std::string> filterNames;
+         f->AddFilterName(filterNames);
+         return !filterNames.empty();
+      });
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -208,6 +219,7 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
                                                                    visitedMap.size(), nodeType);
+      thisNode->SetProfile(GetProfile());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
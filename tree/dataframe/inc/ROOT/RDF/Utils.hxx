@@ -262,6 +262,10 @@ struct Disjunction<B1, Bn...> : std::conditional_t<bool(B1::value), B1, Disjunct
 
 bool IsStrInVec(const std::string &str, const std::vector<std::string> &vec);
 
+/// Merge nObjects partial results into the first one, calling mergeInto(i, j) to merge the j-th into the i-th.
+/// The merge is performed as a tree reduction, concurrently if implicit multi-threading is enabled.
+void TreeMerge(unsigned int nObjects, const std::function<void(unsigned int, unsigned int)> &mergeInto);
+
 /// Return a vector with all elements of v1 and v2 and duplicates removed.
 /// Precondition: each of v1 and v2 must not have duplicate elements.
 template <typename T>
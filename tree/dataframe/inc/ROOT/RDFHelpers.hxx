@@ -186,6 +186,65 @@ unsigned int RunGraphs(std::vector<RResultHandle> handles);
 
 namespace Experimental {
 
+// clang-format off
+/// \brief Record timing information for each node during the following event loops of a computation graph.
+/// \param[in] node any node of the graph: profiling is always enabled for the whole graph.
+///
+/// For each Filter, Define and action, and for each processing slot, the time spent evaluating the node and the
+/// number of entries it processed are recorded. The time a node spends waiting for the Defines it reads is charged
+/// to those Defines, and the time spent outside of any node (reading data from the data source, running the event
+/// loop) is charged to the head node together with the number of bytes read from ROOT files.
+///
+/// Once an event loop has run, SaveGraph() annotates each node with its profile and SaveProfile() exports a
+/// Chrome trace with the timeline of the tasks and the per-node totals of each slot.
+/// Profiling adds a couple of clock reads to each node evaluation: it is not meant to be left enabled in production.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// auto h = df.Define("y", "x * x").Filter("y > 4").Histo1D("y");
+/// h->Draw(); // runs the event loop
+/// ROOT::RDF::SaveGraph(df, "graph.dot"); // nodes show e.g. "12.3 ms, 1000 entries"
+/// ROOT::RDF::Experimental::SaveProfile(df, "profile.json"); // open with chrome://tracing or ui.perfetto.dev
+/// ~~~
+// clang-format on
+template <typename NodeType>
+void EnableProfiling(NodeType node)
+{
+   RDFInternal::EnableProfiling(AsRNode(node));
+}
+
+// clang-format off
+/// \brief Return the profile of the last event loop of a computation graph in Chrome trace JSON format.
+/// \param[in] node any node of the graph.
+///
+/// Profiling must have been enabled with EnableProfiling() before the event loop ran.
+// clang-format on
+template <typename NodeType>
+std::string SaveProfile(NodeType node)
+{
+   return RDFInternal::GetProfileAsChromeTrace(AsRNode(node));
+}
+
+// clang-format off
+/// \brief Write the profile of the last event loop of a computation graph to a file in Chrome trace JSON format.
+/// \param[in] node any node of the graph.
+/// \param[in] outputFile file where to save the profile.
+///
+/// Profiling must have been enabled with EnableProfiling() before the event loop ran.
+// clang-format on
+template <typename NodeType>
+void SaveProfile(NodeType node, const std::string &outputFile)
+{
+   const auto trace = SaveProfile(node);
+
+   std::ofstream out(outputFile);
+   if (!out.is_open()) {
+      throw std::runtime_error("Could not open output file \"" + outputFile + "\" for writing");
+   }
+
+   out << trace;
+}
+
 /// \brief Produce all required systematic variations for the given result.
 /// \param[in] resPtr The result for which variations should be produced.
 /// \return A \ref ROOT::RDF::Experimental::RResultMap "RResultMap" object with full variation names as strings
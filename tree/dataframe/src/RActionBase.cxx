@@ -23,3 +23,9 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() = default;
+
+/// Start collecting a fresh RNodeProfile for this action (or stop profiling it if `enable` is false).
+void RActionBase::SetProfiling(RLoopProfiler *profiler)
+{
+   fProfile = profiler ? profiler->MakeNodeProfile() : nullptr;
+}
@@ -10,9 +10,20 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 
 #include <algorithm> // std::find
 
+namespace {
+/// The dot label of a node: its name, followed by a summary of its profile if it was profiled.
+std::string GetLabel(const ROOT::Internal::RDF::GraphDrawing::GraphNode &node)
+{
+   if (const auto *profile = node.GetProfile())
+      return node.GetName() + "\\n" + profile->GetSummary();
+   return node.GetName();
+}
+} // anonymous namespace
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -28,6 +39,7 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   node->SetProfile(columnPtr->GetProfile());
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -45,6 +57,7 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
 
    auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
                                            ENodeType::kFilter);
+   node->SetProfile(filterPtr->GetProfile());
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
@@ -104,7 +117,7 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(const GraphNode &start) const
    // Explore the graph bottom-up and store its dot representation.
    const GraphNode *leaf = &start;
    while (leaf) {
-      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << GetLabel(*leaf)
                       << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\"" << leaf->GetShape()
                       << "\"];\n";
       if (leaf->GetPrevNode()) {
@@ -126,7 +139,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
    for (auto leafShPtr : leaves) {
       GraphNode *leaf = leafShPtr.get();
       while (leaf && !leaf->IsExplored()) {
-         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << GetLabel(*leaf)
                          << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\""
                          << leaf->GetShape() << "\"];\n";
          if (leaf->GetPrevNode()) {
@@ -165,6 +178,34 @@ std::string GraphCreatorHelper::RepresentGraph(RLoopManager *loopManager)
    return FromGraphActionsToDot(std::move(nodes));
 }
 
+std::string GraphCreatorHelper::RepresentProfile(RLoopManager *loopManager)
+{
+   const auto *profiler = loopManager->GetProfiler();
+   if (!profiler)
+      throw std::logic_error("RDataFrame: profiling was not enabled for this computation graph.");
+
+   // build the graph nodes, which know the names and the profiles of the RDF nodes
+   for (auto *action : loopManager->GetAllActions())
+      action->GetGraph(fVisitedMap);
+   for (auto *edge : loopManager->GetGraphEdges())
+      edge->GetGraph(fVisitedMap);
+
+   std::vector<const GraphNode *> graphNodes;
+   for (const auto &keyAndNode : fVisitedMap) {
+      const auto *profile = keyAndNode.second->GetProfile();
+      if (profile && profile != &profiler->GetSourceProfile())
+         graphNodes.emplace_back(keyAndNode.second.get());
+   }
+   std::sort(graphNodes.begin(), graphNodes.end(),
+             [](const GraphNode *n1, const GraphNode *n2) { return n1->GetID() < n2->GetID(); });
+
+   std::vector<std::pair<std::string, const RNodeProfile *>> nodes;
+   nodes.reserve(graphNodes.size());
+   for (const auto *graphNode : graphNodes)
+      nodes.emplace_back(graphNode->GetName(), graphNode->GetProfile());
+   return profiler->ToChromeTrace(nodes);
+}
+
 } // namespace GraphDrawing
 } // namespace RDF
 } // namespace Internal
@@ -26,6 +26,10 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -426,6 +430,30 @@ bool IsStrInVec(const std::string &str, const std::vector<std::string> &vec)
    return std::find(vec.cbegin(), vec.cend(), str) != vec.cend();
 }
 
+/// At each step of the reduction, the partial result at position i + stride is merged into the one at position i, for
+/// all i that are multiples of 2 * stride; the stride doubles at every step. Merges belonging to the same step act
+/// on disjoint pairs of objects, so with implicit multi-threading enabled they are executed concurrently and the
+/// whole merge takes O(log(nObjects)) sequential steps rather than O(nObjects).
+void TreeMerge(unsigned int nObjects, const std::function<void(unsigned int, unsigned int)> &mergeInto)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nObjects > 2) {
+      ROOT::TThreadExecutor pool;
+      std::vector<unsigned int> targets;
+      for (unsigned int stride = 1u; stride < nObjects; stride *= 2u) {
+         targets.clear();
+         for (unsigned int i = 0u; i + stride < nObjects; i += 2u * stride)
+            targets.emplace_back(i);
+         pool.Foreach([&](unsigned int i) { mergeInto(i, i + stride); }, targets);
+      }
+      return;
+   }
+#endif // R__USE_IMT
+   for (unsigned int stride = 1u; stride < nObjects; stride *= 2u)
+      for (unsigned int i = 0u; i + stride < nObjects; i += 2u * stride)
+         mergeInto(i, i + stride);
+}
+
 auto RStringCache::Insert(const std::string &string) -> decltype(fStrings)::const_iterator
 {
    {
@@ -962,6 +962,17 @@ See [Efficient analysis in Python](#python) for possible ways to speed up hot pa
 Just-in-time compilation happens once, right before starting an event loop. To reduce the runtime cost of this step, make sure to book all operations *for all RDataFrame computation graphs*
 before the first event loop is triggered: just-in-time compilation will happen once for all code required to be generated up to that point, also across different computation graphs.
 
+When reading ROOT files, all branches that an event loop needs are prefetched by the TTreeCache, cluster by cluster.
+Very selective analyses that histogram or write out many columns after a tight `Filter` can save a lot of I/O by setting
+`RDataFrame.LateMaterialization: 1` in their `.rootrc` (or calling `gEnv->SetValue("RDataFrame.LateMaterialization", 1)`
+before the event loop): branches that are only read for entries passing a Filter are then excluded from the prefetching
+and their baskets are only fetched when a selected entry needs them.
+
+To find out which nodes of a large computation graph dominate the runtime, call
+ROOT::RDF::Experimental::EnableProfiling() before triggering the event loop: afterwards, SaveGraph() annotates each
+Filter, Define and action with the time spent evaluating it and the number of entries it processed, and
+ROOT::RDF::Experimental::SaveProfile() exports the per-slot task timeline and per-node totals as a Chrome trace.
+
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). See [Activating RDataFrame execution logs](\ref rdf-logging).
 
 ### Memory usage
@@ -44,6 +44,12 @@ std::string RDefineBase::GetName() const
    return fName;
 }
 
+/// Start collecting a fresh RNodeProfile for this define (or stop profiling it if `enable` is false).
+void RDefineBase::SetProfiling(RDFInternal::RLoopProfiler *profiler)
+{
+   fProfile = profiler ? profiler->MakeNodeProfile() : nullptr;
+}
+
 std::string RDefineBase::GetTypeName() const
 {
    return fType;
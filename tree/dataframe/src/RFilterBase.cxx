@@ -56,6 +56,12 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
    rep.AddCut({fName, accepted, all});
 }
 
+/// Start collecting a fresh RNodeProfile for this filter (or stop profiling it if `enable` is false).
+void RFilterBase::SetProfiling(RDFInternal::RLoopProfiler *profiler)
+{
+   fProfile = profiler ? profiler->MakeNodeProfile() : nullptr;
+}
+
 void RFilterBase::InitNode()
 {
    if (!fName.empty()) // if this is a named filter we care about its report count
@@ -9,6 +9,7 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/RDF/GraphUtils.hxx"
 
 void ROOT::Internal::RDF::ChangeEmptyEntryRange(const ROOT::RDF::RNode &node,
                                                 std::pair<ULong64_t, ULong64_t> &&newRange)
@@ -39,3 +40,22 @@ void ROOT::Internal::RDF::TriggerRun(ROOT::RDF::RNode node)
 {
    node.fLoopManager->Run();
 }
+
+/**
+ * \brief Enable profiling of the event loops of an RDataFrame computation graph.
+ * \param[in] node Any node of the computation graph.
+ */
+void ROOT::Internal::RDF::EnableProfiling(const ROOT::RDF::RNode &node)
+{
+   node.GetLoopManager()->EnableProfiling();
+}
+
+/**
+ * \brief Return the profile of the last event loop of an RDataFrame computation graph as a Chrome trace.
+ * \param[in] node Any node of the computation graph.
+ */
+std::string ROOT::Internal::RDF::GetProfileAsChromeTrace(const ROOT::RDF::RNode &node)
+{
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper;
+   return helper.RepresentProfile(node.GetLoopManager());
+}
@@ -91,6 +91,12 @@ void RJittedAction::TriggerChildrenCount()
    fConcreteAction->TriggerChildrenCount();
 }
 
+bool RJittedAction::HasUpstreamFilters()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->HasUpstreamFilters();
+}
+
 void RJittedAction::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteAction != nullptr);
@@ -39,6 +39,11 @@ const std::type_info &RJittedDefine::GetTypeId() const
                                "retrieved. This should never happen, please report this as a bug.");
 }
 
+const ROOT::Internal::RDF::RNodeProfile *RJittedDefine::GetProfile() const
+{
+   return fConcreteDefine ? fConcreteDefine->GetProfile() : nullptr;
+}
+
 void RJittedDefine::Update(unsigned int slot, Long64_t entry)
 {
    assert(fConcreteDefine != nullptr);
@@ -25,6 +25,7 @@
 #include "TBranchObject.h"
 #include "TChain.h"
 #include "TEntryList.h"
+#include "TEnv.h"
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TROOT.h" // IsImplicitMTEnabled, gCoreMutex, R__*_LOCKGUARD
@@ -53,6 +54,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -236,6 +238,20 @@ void ThrowIfNSlotsChanged(unsigned int nSlots)
    }
 }
 
+/// Insert in datasetColumns the names of the dataset columns that must be read to evaluate the given columns,
+/// following aliases and (possibly jitted) Defines down to the dataset.
+void CollectDatasetColumns(const ColumnNames_t &colNames, const RColumnRegister &colRegister,
+                           std::unordered_set<std::string> &datasetColumns)
+{
+   for (const auto &colName : colNames) {
+      const std::string resolvedName(colRegister.ResolveAlias(colName));
+      if (auto *define = colRegister.GetDefine(resolvedName))
+         CollectDatasetColumns(define->GetColumnNames(), define->GetColRegister(), datasetColumns);
+      else
+         datasetColumns.insert(resolvedName);
+   }
+}
+
 /**
 \struct MaxTreeSizeRAII
 \brief Scope-bound change of `TTree::fgMaxTreeSize`.
@@ -447,6 +463,14 @@ void RLoopManager::ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    }
 }
 
+/// Record per-node timing and entry counts during the following event loops, see
+/// ROOT::RDF::Experimental::EnableProfiling.
+void RLoopManager::EnableProfiling()
+{
+   if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots);
+}
+
 /// Run event loop with no source files, in parallel.
 void RLoopManager::RunEmptySourceMT()
 {
@@ -531,6 +555,7 @@ void RLoopManager::RunTreeProcessorMT()
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot, &r);
+      r.SetDeferredBranches(fDeferredBranches);
       InitNodeSlots(&r, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, slot));
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
@@ -573,6 +598,7 @@ void RLoopManager::RunTreeReader()
          throw std::logic_error("Something went wrong in initializing the TTreeReader.");
 
    RCallCleanUpTask cleanup(*this, 0u, &r);
+   r.SetDeferredBranches(fDeferredBranches);
    InitNodeSlots(&r, 0);
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, 0u));
 
@@ -672,6 +698,9 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fProfiler)
+      fProfiler->CountEntry(slot);
+
    // data-block callbacks run before the rest of the graph
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
@@ -692,6 +721,8 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->StartTask(slot);
    SetupSampleCallbacks(r, slot);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
@@ -756,12 +787,21 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT)
+      EvalDeferredBranches();
    for (auto *filter : fBookedFilters)
       filter->InitNode();
    for (auto *range : fBookedRanges)
       range->InitNode();
    for (auto *ptr : fBookedActions)
       ptr->Initialize();
+
+   for (auto *ptr : fBookedFilters)
+      ptr->SetProfiling(fProfiler.get());
+   for (auto *ptr : fBookedDefines)
+      ptr->SetProfiling(fProfiler.get());
+   for (auto *ptr : fBookedActions)
+      ptr->SetProfiling(fProfiler.get());
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -806,6 +846,9 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+
+   if (fProfiler)
+      fProfiler->StopTask(slot);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -848,6 +891,39 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Evaluate which dataset columns are only needed for entries that pass at least one Filter.
+/// If the `RDataFrame.LateMaterialization` rootrc option is set, these branches are not prefetched by the TTreeCache
+/// (see TTreeReader::SetDeferredBranches): their baskets are then only read for the entries that are actually
+/// selected, which saves I/O in very selective analyses that write or histogram many columns.
+/// Inputs of Filters, of systematic variations and of actions that are not behind a Filter are always prefetched.
+void RLoopManager::EvalDeferredBranches()
+{
+   fDeferredBranches.clear();
+   if (fBookedFilters.empty() || gEnv->GetValue("RDataFrame.LateMaterialization", 0) == 0)
+      return;
+
+   std::unordered_set<std::string> eagerColumns;
+   for (auto *filterPtr : fBookedFilters)
+      CollectDatasetColumns(filterPtr->GetColumnNames(), filterPtr->GetColRegister(), eagerColumns);
+   for (auto *variationPtr : fBookedVariations)
+      CollectDatasetColumns(variationPtr->GetInputColumnNames(), variationPtr->GetColRegister(), eagerColumns);
+
+   std::unordered_set<std::string> filteredColumns;
+   for (auto *actionPtr : fBookedActions) {
+      auto &columns = actionPtr->HasUpstreamFilters() ? filteredColumns : eagerColumns;
+      CollectDatasetColumns(actionPtr->GetColumnNames(), actionPtr->GetColRegister(), columns);
+   }
+
+   for (const auto &colName : filteredColumns) {
+      if (eagerColumns.find(colName) == eagerColumns.end())
+         fDeferredBranches.emplace_back(colName);
+   }
+   if (!fDeferredBranches.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "Deferring the reading of " << fDeferredBranches.size()
+                                   << " column(s) that are only needed after a Filter.";
+   }
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 /// The jitting phase is skipped if the `jit` parameter is `false` (unsafe, use with care).
@@ -880,6 +956,8 @@ void RLoopManager::Run(bool jit)
 
    TStopwatch s;
    s.Start();
+   if (fProfiler)
+      fProfiler->StartLoop();
 
    switch (fLoopType) {
    case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
@@ -890,6 +968,8 @@ void RLoopManager::Run(bool jit)
    case ELoopType::kDataSource: RunDataSource(); break;
    }
    s.Stop();
+   if (fProfiler)
+      fProfiler->StopLoop();
 
    fNRuns++;
 
@@ -1049,6 +1129,8 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RLoopManager::GetG
    }
    auto thisNode = std::make_shared<ROOT::Internal::RDF::GraphDrawing::GraphNode>(
       name, visitedMap.size(), ROOT::Internal::RDF::GraphDrawing::ENodeType::kRoot);
+   if (fProfiler)
+      thisNode->SetProfile(&fProfiler->GetSourceProfile());
    visitedMap[(void *)this] = thisNode;
    return thisNode;
 }
@@ -0,0 +1,177 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RLoopProfiler.hxx"
+#include "TFile.h" // GetFileBytesRead
+
+#include <algorithm>
+#include <cstdio> // snprintf
+#include <iomanip> // setprecision
+#include <sstream>
+
+namespace {
+/// Escape a node name for use in a JSON string. Node names use a literal "\n" as line break for dot.
+std::string ToJSONString(const std::string &name)
+{
+   std::string res;
+   res.reserve(name.size() + 2);
+   res += '"';
+   for (std::size_t i = 0u; i < name.size(); ++i) {
+      const char c = name[i];
+      if (c == '\\' && i + 1 < name.size() && name[i + 1] == 'n') {
+         res += ' ';
+         ++i;
+      } else if (c == '"' || c == '\\') {
+         res += '\\';
+         res += c;
+      } else {
+         res += c;
+      }
+   }
+   res += '"';
+   return res;
+}
+
+/// Chrome traces expect timestamps and durations in microseconds.
+double ToMicroseconds(ULong64_t nanoseconds)
+{
+   return nanoseconds / 1000.;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+ULong64_t RNodeProfile::GetTotalNanoseconds() const
+{
+   ULong64_t total = 0ull;
+   for (auto slot = 0u; slot < GetNSlots(); ++slot)
+      total += GetNanoseconds(slot);
+   return total;
+}
+
+ULong64_t RNodeProfile::GetTotalEntries() const
+{
+   ULong64_t total = 0ull;
+   for (auto slot = 0u; slot < GetNSlots(); ++slot)
+      total += GetEntries(slot);
+   return total;
+}
+
+std::string RNodeProfile::GetSummary() const
+{
+   char buf[128];
+   std::snprintf(buf, sizeof(buf), "%.3g ms, %llu entries", GetTotalNanoseconds() / 1e6,
+                 static_cast<unsigned long long>(GetTotalEntries()));
+   std::string summary(buf);
+   if (fBytesRead > 0) {
+      std::snprintf(buf, sizeof(buf), ", %.3g MB read", fBytesRead / 1e6);
+      summary += buf;
+   }
+   return summary;
+}
+
+void RNodeTimer::Stop()
+{
+   const ULong64_t elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fStart).count();
+   fProfile->Add(fSlot, elapsed > fNestedNanoseconds ? elapsed - fNestedNanoseconds : 0ull, fEntries);
+   if (fParent)
+      fParent->fNestedNanoseconds += elapsed;
+   fProfile->CurrentTimer(fSlot) = fParent;
+   fProfile = nullptr;
+}
+
+RLoopProfiler::RLoopProfiler(unsigned int nSlots)
+   : fNSlots(nSlots),
+     fCurrentTimers(nSlots * CacheLineStep<RNodeTimer *>()),
+     fSourceProfile(nSlots, fCurrentTimers.data()),
+     fTasks(nSlots), fTaskTimers(nSlots), fTaskStartEntries(nSlots)
+{
+}
+
+ULong64_t RLoopProfiler::NanosecondsSinceLoopStart() const
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fLoopStart).count();
+}
+
+/// Reset all counters and start measuring a new event loop.
+void RLoopProfiler::StartLoop()
+{
+   fSourceProfile = RNodeProfile(fNSlots, fCurrentTimers.data());
+   for (auto &tasks : fTasks)
+      tasks.clear();
+   fLoopStartBytesRead = TFile::GetFileBytesRead();
+   fLoopStart = std::chrono::steady_clock::now();
+}
+
+void RLoopProfiler::StopLoop()
+{
+   fSourceProfile.SetBytesRead(TFile::GetFileBytesRead() - fLoopStartBytesRead);
+}
+
+void RLoopProfiler::StartTask(unsigned int slot)
+{
+   fTaskStartEntries[slot] = fSourceProfile.GetEntries(slot);
+   fTasks[slot].push_back({NanosecondsSinceLoopStart(), 0ull, 0ull});
+   fTaskTimers[slot].reset(new RNodeTimer(&fSourceProfile, slot, /*entries*/ 0ull));
+}
+
+void RLoopProfiler::StopTask(unsigned int slot)
+{
+   if (!fTaskTimers[slot])
+      return;
+   fTaskTimers[slot].reset();
+   auto &task = fTasks[slot].back();
+   task.fEnd = NanosecondsSinceLoopStart();
+   task.fEntries = fSourceProfile.GetEntries(slot) - fTaskStartEntries[slot];
+}
+
+std::string RLoopProfiler::ToChromeTrace(const std::vector<std::pair<std::string, const RNodeProfile *>> &nodes) const
+{
+   // Process 0 shows the actual timeline of the tasks run by each slot. Process 1 shows, for each slot, the time
+   // spent in each node during the whole event loop: these are totals, laid out one after the other from the
+   // most to the least expensive node, not a timeline.
+   std::stringstream ss;
+   ss << std::fixed << std::setprecision(3);
+   ss << "{\"traceEvents\":[\n";
+   ss << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"RDataFrame tasks\"}},\n";
+   ss << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RDataFrame nodes (totals)\"}}";
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      for (const auto &task : fTasks[slot]) {
+         ss << ",\n{\"name\":\"task\",\"ph\":\"X\",\"pid\":0,\"tid\":" << slot
+            << ",\"ts\":" << ToMicroseconds(task.fStart) << ",\"dur\":" << ToMicroseconds(task.fEnd - task.fStart)
+            << ",\"args\":{\"entries\":" << task.fEntries << "}}";
+      }
+   }
+
+   std::vector<std::pair<std::string, const RNodeProfile *>> allNodes(nodes);
+   allNodes.emplace_back("Data source and event loop", &fSourceProfile);
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      std::sort(allNodes.begin(), allNodes.end(), [slot](const auto &n1, const auto &n2) {
+         return n1.second->GetNanoseconds(slot) > n2.second->GetNanoseconds(slot);
+      });
+      ULong64_t ts = 0ull;
+      for (const auto &node : allNodes) {
+         const auto ns = node.second->GetNanoseconds(slot);
+         if (ns == 0ull && node.second->GetEntries(slot) == 0ull)
+            continue;
+         ss << ",\n{\"name\":" << ToJSONString(node.first) << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << slot
+            << ",\"ts\":" << ToMicroseconds(ts) << ",\"dur\":" << ToMicroseconds(ns)
+            << ",\"args\":{\"entries\":" << node.second->GetEntries(slot) << "}}";
+         ts += ns;
+      }
+   }
+   ss << "\n],\n\"otherData\":{\"bytesRead\":" << fSourceProfile.GetBytesRead() << "}}\n";
+   return ss.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
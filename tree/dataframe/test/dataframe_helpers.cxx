@@ -430,6 +430,32 @@ TEST(RDFHelpers, SaveGraphSharedDefines)
    EXPECT_EQ(graph, expected);
 }
 
+TEST(RDFHelpers, Profiling)
+{
+   ROOT::RDataFrame df(10);
+   EXPECT_THROW(ROOT::RDF::Experimental::SaveProfile(df), std::logic_error);
+
+   ROOT::RDF::Experimental::EnableProfiling(df);
+   auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Filter([](double x) { return x >= 5; }, {"x"})
+                 .Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 35.);
+
+   // each node is annotated with its profile
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(graph.find("Define\\nx\\n"), std::string::npos) << graph;
+   EXPECT_NE(graph.find("Filter\\n"), std::string::npos) << graph;
+   EXPECT_NE(graph.find("Sum\\n"), std::string::npos) << graph;
+   EXPECT_NE(graph.find("ms, 10 entries"), std::string::npos) << graph;
+   EXPECT_NE(graph.find("ms, 5 entries"), std::string::npos) << graph;
+
+   const auto trace = ROOT::RDF::Experimental::SaveProfile(df);
+   EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+   EXPECT_NE(trace.find("\"name\":\"task\""), std::string::npos) << trace;
+   EXPECT_NE(trace.find("\"name\":\"Define x\""), std::string::npos) << trace;
+   EXPECT_NE(trace.find("\"name\":\"Data source and event loop\""), std::string::npos) << trace;
+}
+
 TEST(RDFHelpers, GraphContainers)
 {
    const std::vector<double> xx = {-0.22, 0.05, 0.25, 0.35, 0.5, 0.61, 0.7, 0.85, 0.89, 0.95};
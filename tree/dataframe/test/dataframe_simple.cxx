@@ -4,7 +4,9 @@
 #include <ROOT/TestSupport.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/TSeq.hxx>
+#include <ROOT/RLogger.hxx>
 #include <TChain.h>
+#include <TEnv.h>
 #include <TFile.h>
 #include <TGraph.h>
 #include <TInterpreter.h>
@@ -13,6 +15,7 @@
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TTree.h>
+#include <TTreeCache.h>
 
 #include <algorithm> // std::sort
 #include <array>
@@ -1076,6 +1079,76 @@ TEST_P(RDFSimpleTests, ReadStdArray)
    }
 }
 
+// With the RDataFrame.LateMaterialization option, the columns only needed behind a Filter are not prefetched,
+// and the cache miss optimization that is enabled for them is undone after the event loop.
+TEST_P(RDFSimpleTests, LateMaterialization)
+{
+   struct LogCollector : public ROOT::Experimental::RLogHandler {
+      std::vector<std::string> &fMessages;
+      LogCollector(std::vector<std::string> &messages) : fMessages(messages) {}
+      bool Emit(const ROOT::Experimental::RLogEntry &entry) override
+      {
+         if (entry.fChannel == &ROOT::Detail::RDF::RDFLogChannel())
+            fMessages.emplace_back(entry.fMessage);
+         return true;
+      }
+   };
+
+   const auto filename = "rdf_simple_latematerialization.root";
+   {
+      TFile f(filename, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(10);
+      int x = 0;
+      double y = 0.;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (int i = 0; i < 100; ++i) {
+         x = i;
+         y = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const int prevLateMaterialization = gEnv->GetValue("RDataFrame.LateMaterialization", 0);
+   gEnv->SetValue("RDataFrame.LateMaterialization", 1);
+
+   std::vector<std::string> messages;
+   auto collector = std::make_unique<LogCollector>(messages);
+   auto *collectorPtr = collector.get();
+   ROOT::Experimental::RLogManager::Get().PushFront(std::move(collector));
+   {
+      auto verbosity = ROOT::Experimental::RLogScopedVerbosity(ROOT::Detail::RDF::RDFLogChannel(),
+                                                               ROOT::Experimental::ELogLevel::kInfo);
+
+      TFile f(filename);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      auto *cache = t->GetReadCache(&f, true);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_FALSE(cache->GetOptimizeMisses());
+
+      // y is only read for the entries that pass the Filter, x is always needed
+      ROOT::RDataFrame df = GetParam() ? ROOT::RDataFrame("t", filename) : ROOT::RDataFrame(*t);
+      auto sumY = df.Filter([](int x) { return x % 10 == 0; }, {"x"}).Sum<double>("y");
+      auto sumX = df.Sum<int>("x");
+      EXPECT_DOUBLE_EQ(*sumY, 0.5 * (0 + 10 + 20 + 30 + 40 + 50 + 60 + 70 + 80 + 90));
+      EXPECT_EQ(*sumX, 99 * 100 / 2);
+
+      // the cache of the user's tree keeps its setting
+      EXPECT_EQ(t->GetReadCache(&f), cache);
+      EXPECT_FALSE(cache->GetOptimizeMisses());
+   }
+   ROOT::Experimental::RLogManager::Get().Remove(collectorPtr);
+   gEnv->SetValue("RDataFrame.LateMaterialization", prevLateMaterialization);
+   gSystem->Unlink(filename);
+
+   EXPECT_NE(std::find(messages.begin(), messages.end(),
+                       "Deferring the reading of 1 column(s) that are only needed after a Filter."),
+             messages.end());
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
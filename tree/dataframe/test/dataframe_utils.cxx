@@ -4,6 +4,7 @@
 
 #include "gtest/gtest.h"
 
+#include <numeric> // std::iota
 #include <stdexcept>
 #include <vector>
 
@@ -236,3 +237,21 @@ TEST(RDataFrameUtils, TypeName2TypeID)
    // TODO(jblomer): Ideally, we would want the next one not to throw an exception
    EXPECT_THROW(RDFInt::TypeName2TypeID("std::vector<std::vector<float>>"), std::runtime_error);
 }
+
+TEST(RDataFrameUtils, TreeMerge)
+{
+   for (unsigned int n : {1u, 2u, 3u, 8u, 13u}) {
+      std::vector<int> values(n);
+      std::iota(values.begin(), values.end(), 1);
+      std::vector<int> merged(n, 0);
+      RDFInt::TreeMerge(n, [&](unsigned int to, unsigned int from) {
+         values[to] += values[from];
+         ++merged[from];
+      });
+      EXPECT_EQ(values[0], int(n * (n + 1) / 2));
+      // every object but the first one is merged exactly once
+      EXPECT_EQ(merged[0], 0);
+      for (unsigned int i = 1u; i < n; ++i)
+         EXPECT_EQ(merged[i], 1);
+   }
+}
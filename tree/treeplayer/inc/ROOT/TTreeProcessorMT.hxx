@@ -91,6 +91,7 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static bool fgClusterSplitting;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
@@ -111,6 +112,8 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetClusterSplitting(bool clusterSplitting);
+   static bool GetClusterSplitting();
 };
 
 } // End of namespace ROOT
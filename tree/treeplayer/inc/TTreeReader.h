@@ -29,11 +29,14 @@
 #include <deque>
 #include <iterator>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
+#include <vector>
 
 class TDictionary;
 class TDirectory;
 class TFileCollection;
+class TTreeCache;
 
 namespace ROOT {
 namespace Internal {
@@ -239,6 +242,8 @@ public:
 
    ///\}
 
+   void SetDeferredBranches(const std::vector<std::string> &branchNames);
+
    EEntryStatus GetEntryStatus() const { return fEntryStatus; }
 
    Long64_t GetEntries() const;
@@ -325,6 +330,11 @@ private:
    Long64_t fEndEntry = -1LL;
    Long64_t fBeginEntry = 0LL; ///< This allows us to propagate the range to the TTreeCache
    bool fProxiesSet = false; ///< True if the proxies have been set, false otherwise
+   /// Names of the branches (as passed to the value readers) that must not be prefetched by the TTreeCache
+   std::unordered_set<std::string> fDeferredBranches;
+   /// Cache on which the cache miss optimization was enabled for the deferred branches, and its previous setting
+   TTreeCache *fCacheWithOptimizedMisses = nullptr;
+   bool fPrevOptimizeMisses = false;
    bool fSetEntryBaseCallingLoadTree = false; ///< True if during the LoadTree execution triggered by SetEntryBase.
 
    // Flag to activate or deactivate warnings in case the friend trees have
@@ -334,6 +344,7 @@ private:
    // alignment.
    bool fWarnAboutLongerFriends{true};
    void WarnIfFriendsHaveMoreEntries();
+   void RestoreCacheOptimizeMisses();
 
    friend class ROOT::Internal::TTreeReaderValueBase;
    friend class ROOT::Internal::TTreeReaderArrayBase;
@@ -124,11 +124,46 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+////////////////////////////////////////////////////////////////////////
+/// Split the entry ranges of a file that are much larger than the others at entry boundaries,
+/// so that the file yields around maxTasksPerFile tasks of similar size.
+/// Nothing is done if the file already yields at least maxTasksPerFile tasks.
+std::vector<EntryRange> SplitLargeRanges(std::vector<EntryRange> &&ranges, const unsigned int maxTasksPerFile)
+{
+   if (ranges.empty() || ranges.size() >= maxTasksPerFile)
+      return std::move(ranges);
+
+   Long64_t nEntries = 0ll;
+   for (const auto &r : ranges)
+      nEntries += r.second - r.first;
+   const Long64_t targetSize = std::max(1ll, (nEntries + maxTasksPerFile - 1) / maxTasksPerFile);
+
+   std::vector<EntryRange> splitRanges;
+   splitRanges.reserve(maxTasksPerFile + ranges.size());
+   for (const auto &r : ranges) {
+      const Long64_t size = r.second - r.first;
+      const Long64_t nPieces = (size + targetSize - 1) / targetSize;
+      // distribute the reminder evenly onto the first pieces, as done when fusing clusters
+      const Long64_t pieceSize = size / nPieces;
+      Long64_t nReminderEntries = size % nPieces;
+      Long64_t start = r.first;
+      for (Long64_t i = 0ll; i < nPieces; ++i) {
+         const Long64_t end = start + pieceSize + (nReminderEntries > 0 ? 1 : 0);
+         if (nReminderEntries > 0)
+            --nReminderEntries;
+         splitRanges.emplace_back(EntryRange{start, end});
+         start = end;
+      }
+   }
+   return splitRanges;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
 ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       const bool splitClusters = false)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
@@ -217,9 +252,10 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
       const auto clustersInThisFileSize = clustersPerFileIt->size();
       const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
       // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
+      // we take the clusters as they are, possibly splitting the largest ones
       if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
+         *eventRangesPerFileIt = splitClusters ? SplitLargeRanges(std::move(*clustersPerFileIt), maxTasksPerFile)
+                                               : std::move(*clustersPerFileIt);
          continue;
       }
       // Otherwise, we have to merge clusters, distributing the reminder evenly
@@ -249,6 +285,7 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgClusterSplitting = false;
 
 namespace Internal {
 
@@ -470,7 +507,8 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries =
+         MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange, GetClusterSplitting());
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
@@ -490,7 +528,9 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const auto clustersAndEntries =
+         MakeClusters(treeNames, fileNames, maxTasksPerFile, {0, std::numeric_limits<Long64_t>::max()},
+                      GetClusterSplitting());
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
       auto processCluster = [&](const EntryRange &c) {
@@ -542,3 +582,27 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve whether clusters larger than the desired task size are split.
+/// \return true if TTreeProcessorMT splits large clusters, see SetClusterSplitting().
+bool TTreeProcessorMT::GetClusterSplitting()
+{
+   return fgClusterSplitting;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable the splitting of large clusters into several tasks.
+/// \param[in] clusterSplitting Whether large clusters should be split.
+///
+/// By default tasks never start or end in the middle of a cluster. If a file
+/// yields fewer tasks than requested by GetTasksPerWorkerHint(), for example
+/// because it is made of a few huge clusters, the last tasks to be picked up
+/// can keep a handful of threads busy while all others are idle. With cluster
+/// splitting enabled, the clusters of such files are split at entry boundaries
+/// into tasks of similar size, which idle workers can pick up. The price is
+/// that the baskets of a split cluster are read and decompressed once per task.
+void TTreeProcessorMT::SetClusterSplitting(bool clusterSplitting)
+{
+   fgClusterSplitting = clusterSplitting;
+}
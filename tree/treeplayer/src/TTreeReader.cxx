@@ -249,8 +249,11 @@ TTreeReader::~TTreeReader()
            i = fValues.begin(), e = fValues.end(); i != e; ++i) {
       (*i)->MarkTreeReaderUnavailable();
    }
-   if (fTree && fNotify.IsLinked())
+   // the link is cleared when the tree is deleted before us
+   if (fTree && fNotify.IsLinked()) {
+      RestoreCacheOptimizeMisses();
       fNotify.RemoveLink(*fTree);
+   }
 
    if (fEntryStatus != kEntryNoTree && !TestBit(kBitIsExternalTree)) {
       // a plain TTree is automatically added to the current directory,
@@ -369,22 +372,53 @@ bool TTreeReader::SetProxies() {
    // Operations 1, 2 and 3 need to happen in this order. See: https://sft.its.cern.ch/jira/browse/ROOT-9773?focusedCommentId=87837
    if (fProxiesSet) {
       const auto curFile = fTree->GetCurrentFile();
-      if (curFile && fTree->GetTree()->GetReadCache(curFile, true)) {
+      auto *tc = curFile ? fTree->GetTree()->GetReadCache(curFile, true) : nullptr;
+      if (tc) {
          if (!(-1LL == fEndEntry && 0ULL == fBeginEntry)) {
             // We need to avoid to pass -1 as end entry to the SetCacheEntryRange method
             const auto lastEntry = (-1LL == fEndEntry) ? fTree->GetEntriesFast() : fEndEntry;
             fTree->SetCacheEntryRange(fBeginEntry, lastEntry);
          }
+         bool hasDeferredBranches = false;
          for (auto value: fValues) {
+            if (fDeferredBranches.count(value->GetBranchName()) > 0) {
+               // the branch might still be in the cache from a previous reader of the same tree
+               fTree->DropBranchFromCache(value->GetProxy()->GetBranchName(), true);
+               hasDeferredBranches = true;
+               continue;
+            }
             fTree->AddBranchToCache(value->GetProxy()->GetBranchName(), true);
          }
          fTree->StopCacheLearningPhase();
+         // Deferred branches are read on demand: let the cache group their baskets on a miss.
+         // The cache may belong to the user, so the previous setting is restored when we are done.
+         if (hasDeferredBranches && tc != fCacheWithOptimizedMisses) {
+            RestoreCacheOptimizeMisses();
+            fCacheWithOptimizedMisses = tc;
+            fPrevOptimizeMisses = tc->GetOptimizeMisses();
+            tc->SetOptimizeMisses(true);
+         }
       }
    }
 
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Restore the cache miss optimization setting of the cache on which it was enabled
+/// for the deferred branches, if that cache is still the one of the current tree.
+
+void TTreeReader::RestoreCacheOptimizeMisses()
+{
+   if (!fCacheWithOptimizedMisses)
+      return;
+   const auto curFile = fTree ? fTree->GetCurrentFile() : nullptr;
+   auto *tc = curFile ? fTree->GetTree()->GetReadCache(curFile) : nullptr;
+   if (tc == fCacheWithOptimizedMisses)
+      tc->SetOptimizeMisses(fPrevOptimizeMisses);
+   fCacheWithOptimizedMisses = nullptr;
+}
+
 void TTreeReader::WarnIfFriendsHaveMoreEntries()
 {
    if (!fWarnAboutLongerFriends)
@@ -526,6 +560,25 @@ void TTreeReader::Restart() {
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Do not add the given branches to the TTreeCache.
+///
+/// Branches that are only needed for a small subset of the entries (e.g. the
+/// ones passing a selection) are better not prefetched together with the
+/// others: when excluded from the TTreeCache, their baskets are only fetched
+/// for the entries that are actually read, grouped together through the
+/// TTreeCache miss optimization (see TTreeCache::SetOptimizeMisses).
+/// Branches are identified by the name passed to the TTreeReaderValue /
+/// TTreeReaderArray constructor. The setting takes effect the next time the
+/// readers are attached to the tree, i.e. it must be called before the first
+/// entry is loaded.
+
+void TTreeReader::SetDeferredBranches(const std::vector<std::string> &branchNames)
+{
+   fDeferredBranches.clear();
+   fDeferredBranches.insert(branchNames.begin(), branchNames.end());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries of the TEntryList if one is provided, else
 /// of the TTree / TChain, independent of a range set by SetEntriesRange()
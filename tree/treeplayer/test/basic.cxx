@@ -5,6 +5,7 @@
 #include "TLeaf.h"
 #include "TROOT.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -534,3 +535,43 @@ TEST(TTreeReaderBasic, ZeroEntriesTree)
    EXPECT_TRUE(b++ == e);
    EXPECT_TRUE(++b_copy == e);
 }
+
+TEST(TTreeReaderBasic, DeferredBranches)
+{
+   const auto fileName = "TTreeReaderBasic_DeferredBranches.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      int y = 0;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (x = 0; x < 100; ++x) {
+         y = 2 * x;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("t");
+   TTreeReader r(t);
+   r.SetDeferredBranches({"y"});
+   TTreeReaderValue<int> x(r, "x");
+   TTreeReaderValue<int> y(r, "y");
+   int sum = 0;
+   while (r.Next()) {
+      if (*x % 10 == 0)
+         sum += *y;
+   }
+   EXPECT_EQ(sum, 900);
+
+   auto *tc = t->GetReadCache(&f);
+   ASSERT_NE(tc, nullptr);
+   EXPECT_NE(tc->GetCachedBranches()->FindObject("x"), nullptr);
+   EXPECT_EQ(tc->GetCachedBranches()->FindObject("y"), nullptr);
+   EXPECT_TRUE(tc->GetOptimizeMisses());
+
+   f.Close();
+   gSystem->Unlink(fileName);
+}
@@ -433,6 +433,51 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, ClusterSplitting)
+{
+   const auto nEvents = 1000;
+   const auto filename = "TreeProcessorMT_ClusterSplitting.root";
+   const auto treename = "t";
+   {
+      // a single cluster with all entries
+      int v = 0;
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      t.SetAutoFlush(nEvents);
+      t.Branch("v", &v);
+      for (auto i = 0; i < nEvents; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto get_clusters = [&m, &clusters](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+   };
+
+   ROOT::EnableImplicitMT(4);
+   const auto nTasks = ROOT::TTreeProcessorMT::GetTasksPerWorkerHint() * ROOT::GetThreadPoolSize();
+   {
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+      EXPECT_EQ(clusters.size(), 1u);
+      clusters.clear();
+   }
+   ROOT::TTreeProcessorMT::SetClusterSplitting(true);
+   {
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+      EXPECT_EQ(clusters.size(), nTasks);
+      CheckClusters(clusters, nEvents);
+   }
+   ROOT::TTreeProcessorMT::SetClusterSplitting(false);
+   ROOT::DisableImplicitMT();
+
+   gSystem->Unlink(filename);
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};